@@ -0,0 +1,22 @@
+// Measures the CPU cost of drawWatchFace() on the watch itself.
+// Renders every minute of a day into the framebuffer (the panel is not
+// refreshed) and prints min/mean/p99 render time and framebuffer checksums
+// to the serial monitor at 115200 baud. Replace Watchy with your own face
+// class to benchmark it; matching checksums before and after a change mean
+// the face still draws the same pixels. Uncomment the fastBlit line to time
+// the Adafruit GFX per-pixel drawBitmap path instead; the day checksum must
+// come out the same either way. extras/host runs the same benchmark for
+// every example face on a PC.
+
+#include <Watchy.h>
+#include "settings.h"
+
+Watchy watchy(settings);
+
+void setup(){
+  // Watchy::display.fastBlit = false;
+  watchy.benchmarkWatchFace();
+  watchy.deepSleep();
+}
+
+void loop(){}
@@ -0,0 +1,94 @@
+// Generated by extras/glyph_atlas.py from DSEG7_Classic_Bold_25.h, '-' to ':'.
+// Do not edit, rerun the script instead.
+const uint8_t DSEG7_Classic_Bold_25AtlasBitmaps[] PROGMEM = {
+    0x7F, 0xE0, 0xFF, 0xF0, 0x7F, 0xE0, // '-'
+    0x60, 0xF0, 0x60, // '.'
+    0xFE, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82,
+    0x82, 0x82, 0x82, 0x82, 0xFE, // '/'
+    0x3F, 0xFE, 0x00, 0x7F, 0xFD, 0x00, 0xFF, 0xFB, 0x00, 0xF0, 0x07, 0x00,
+    0xF0, 0x07, 0x00, 0xF0, 0x07, 0x00, 0xF0, 0x07, 0x00, 0xF0, 0x07, 0x00,
+    0xF0, 0x07, 0x00, 0xF0, 0x07, 0x00, 0xF0, 0x07, 0x00, 0xE0, 0x03, 0x00,
+    0x00, 0x00, 0x00, 0xE0, 0x03, 0x00, 0xF0, 0x07, 0x00, 0xF0, 0x07, 0x00,
+    0xF0, 0x07, 0x00, 0xF0, 0x07, 0x00, 0xF0, 0x07, 0x00, 0xF0, 0x07, 0x00,
+    0xF0, 0x07, 0x00, 0xF0, 0x07, 0x00, 0xFF, 0xFB, 0x00, 0x7F, 0xFD, 0x00,
+    0x3F, 0xFE, 0x00, // '0'
+    0x20, 0x60, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0x60, 0x00,
+    0x60, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0x60, 0x20, // '1'
+    0x3F, 0xFE, 0x00, 0x3F, 0xFD, 0x00, 0x1F, 0xFB, 0x00, 0x00, 0x07, 0x00,
+    0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00,
+    0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x1F, 0xFB, 0x00,
+    0x3F, 0xFC, 0x00, 0xFF, 0xF8, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00,
+    0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00,
+    0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x7F, 0xFC, 0x00,
+    0x3F, 0xFE, 0x00, // '2'
+    0xFF, 0xF8, 0xFF, 0xF4, 0x7F, 0xEC, 0x00, 0x1C, 0x00, 0x1C, 0x00, 0x1C,
+    0x00, 0x1C, 0x00, 0x1C, 0x00, 0x1C, 0x00, 0x1C, 0x00, 0x1C, 0x7F, 0xEC,
+    0xFF, 0xF0, 0x7F, 0xEC, 0x00, 0x1C, 0x00, 0x1C, 0x00, 0x1C, 0x00, 0x1C,
+    0x00, 0x1C, 0x00, 0x1C, 0x00, 0x1C, 0x00, 0x1C, 0x7F, 0xEC, 0xFF, 0xF4,
+    0xFF, 0xF8, // '3'
+    0x40, 0x01, 0x00, 0xE0, 0x03, 0x00, 0xF0, 0x07, 0x00, 0xF0, 0x07, 0x00,
+    0xF0, 0x07, 0x00, 0xF0, 0x07, 0x00, 0xF0, 0x07, 0x00, 0xF0, 0x07, 0x00,
+    0xF0, 0x07, 0x00, 0xF0, 0x07, 0x00, 0xFF, 0xFB, 0x00, 0x3F, 0xFC, 0x00,
+    0x1F, 0xFB, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00,
+    0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00,
+    0x00, 0x07, 0x00, 0x00, 0x03, 0x00, 0x00, 0x01, 0x00, // '4'
+    0x3F, 0xFE, 0x00, 0x7F, 0xFC, 0x00, 0xFF, 0xF8, 0x00, 0xF0, 0x00, 0x00,
+    0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00,
+    0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xFF, 0xF8, 0x00,
+    0x3F, 0xFC, 0x00, 0x1F, 0xFB, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00,
+    0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00,
+    0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x1F, 0xFB, 0x00, 0x3F, 0xFD, 0x00,
+    0x3F, 0xFE, 0x00, // '5'
+    0x3F, 0xFE, 0x00, 0x7F, 0xFC, 0x00, 0xFF, 0xF8, 0x00, 0xF0, 0x00, 0x00,
+    0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00,
+    0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xFF, 0xF8, 0x00,
+    0x3F, 0xFC, 0x00, 0xFF, 0xFB, 0x00, 0xF0, 0x07, 0x00, 0xF0, 0x07, 0x00,
+    0xF0, 0x07, 0x00, 0xF0, 0x07, 0x00, 0xF0, 0x07, 0x00, 0xF0, 0x07, 0x00,
+    0xF0, 0x07, 0x00, 0xF0, 0x07, 0x00, 0xFF, 0xFB, 0x00, 0x7F, 0xFD, 0x00,
+    0x3F, 0xFE, 0x00, // '6'
+    0x3F, 0xFE, 0x00, 0x7F, 0xFD, 0x00, 0xFF, 0xFB, 0x00, 0xF0, 0x07, 0x00,
+    0xF0, 0x07, 0x00, 0xF0, 0x07, 0x00, 0xF0, 0x07, 0x00, 0xF0, 0x07, 0x00,
+    0xF0, 0x07, 0x00, 0xF0, 0x07, 0x00, 0xF0, 0x07, 0x00, 0xE0, 0x03, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00,
+    0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00,
+    0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x03, 0x00, 0x00, 0x01, 0x00, // '7'
+    0x3F, 0xFE, 0x00, 0x7F, 0xFD, 0x00, 0xFF, 0xFB, 0x00, 0xF0, 0x07, 0x00,
+    0xF0, 0x07, 0x00, 0xF0, 0x07, 0x00, 0xF0, 0x07, 0x00, 0xF0, 0x07, 0x00,
+    0xF0, 0x07, 0x00, 0xF0, 0x07, 0x00, 0xF0, 0x07, 0x00, 0xFF, 0xFB, 0x00,
+    0x3F, 0xFC, 0x00, 0xFF, 0xFB, 0x00, 0xF0, 0x07, 0x00, 0xF0, 0x07, 0x00,
+    0xF0, 0x07, 0x00, 0xF0, 0x07, 0x00, 0xF0, 0x07, 0x00, 0xF0, 0x07, 0x00,
+    0xF0, 0x07, 0x00, 0xF0, 0x07, 0x00, 0xFF, 0xFB, 0x00, 0x7F, 0xFD, 0x00,
+    0x3F, 0xFE, 0x00, // '8'
+    0x3F, 0xFE, 0x00, 0x7F, 0xFD, 0x00, 0xFF, 0xFB, 0x00, 0xF0, 0x07, 0x00,
+    0xF0, 0x07, 0x00, 0xF0, 0x07, 0x00, 0xF0, 0x07, 0x00, 0xF0, 0x07, 0x00,
+    0xF0, 0x07, 0x00, 0xF0, 0x07, 0x00, 0xF0, 0x07, 0x00, 0xFF, 0xFB, 0x00,
+    0x3F, 0xFC, 0x00, 0x1F, 0xFB, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00,
+    0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00,
+    0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x1F, 0xFB, 0x00, 0x3F, 0xFD, 0x00,
+    0x3F, 0xFE, 0x00, // '9'
+    0x40, 0xE0, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xE0,
+    0xE0, 0x40, // ':'
+};
+const WatchyAtlasGlyph DSEG7_Classic_Bold_25AtlasGlyphs[] PROGMEM = {
+    // bitmapOffset, width, height, xAdvance, xOffset, yOffset
+    {0, 13, 3, 21, 4, -14}, // '-'
+    {6, 5, 3, 1, -2, -3}, // '.'
+    {9, 8, 17, 10, 1, -17}, // '/'
+    {26, 17, 25, 21, 2, -25}, // '0'
+    {101, 4, 23, 21, 15, -24}, // '1'
+    {124, 17, 25, 21, 2, -25}, // '2'
+    {199, 15, 25, 21, 4, -25}, // '3'
+    {249, 17, 23, 21, 2, -24}, // '4'
+    {318, 17, 25, 21, 2, -25}, // '5'
+    {393, 17, 25, 21, 2, -25}, // '6'
+    {468, 17, 24, 21, 2, -25}, // '7'
+    {540, 17, 25, 21, 2, -25}, // '8'
+    {615, 17, 25, 21, 2, -25}, // '9'
+    {690, 4, 14, 6, 1, -19}  // ':'
+};
+const WatchyGlyphAtlas DSEG7_Classic_Bold_25Atlas PROGMEM = {
+    DSEG7_Classic_Bold_25AtlasBitmaps,
+    DSEG7_Classic_Bold_25AtlasGlyphs,
+    0x2D, 0x3A, 28};
+
+// Approx. 828 bytes
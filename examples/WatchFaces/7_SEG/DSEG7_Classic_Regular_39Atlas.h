@@ -0,0 +1,152 @@
+// Generated by extras/glyph_atlas.py from DSEG7_Classic_Regular_39.h, '-' to ':'.
+// Do not edit, rerun the script instead.
+const uint8_t DSEG7_Classic_Regular_39AtlasBitmaps[] PROGMEM = {
+    0x7F, 0xFF, 0xE0, 0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 0xE0, // '-'
+    0x60, 0xF0, 0xF0, 0xF0, 0x60, // '.'
+    0xFF, 0xC0, 0x80, 0x40, 0x80, 0x40, 0x80, 0x40, 0x80, 0x40, 0x80, 0x40,
+    0x80, 0x40, 0x80, 0x40, 0x80, 0x40, 0x80, 0x40, 0x80, 0x40, 0x80, 0x40,
+    0x80, 0x40, 0x80, 0x40, 0x80, 0x40, 0x80, 0x40, 0x80, 0x40, 0x80, 0x40,
+    0x80, 0x40, 0x80, 0x40, 0x80, 0x40, 0x80, 0x40, 0x80, 0x40, 0x80, 0x40,
+    0x80, 0x40, 0xFF, 0xC0, // '/'
+    0x3F, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0xDF, 0xFF, 0xFB, 0x00,
+    0xEF, 0xFF, 0xF7, 0x00, 0xE0, 0x00, 0x0F, 0x00, 0xE0, 0x00, 0x0F, 0x00,
+    0xE0, 0x00, 0x0F, 0x00, 0xE0, 0x00, 0x0F, 0x00, 0xE0, 0x00, 0x0F, 0x00,
+    0xE0, 0x00, 0x0F, 0x00, 0xE0, 0x00, 0x0F, 0x00, 0xE0, 0x00, 0x0F, 0x00,
+    0xE0, 0x00, 0x0F, 0x00, 0xE0, 0x00, 0x0F, 0x00, 0xE0, 0x00, 0x0F, 0x00,
+    0xE0, 0x00, 0x0F, 0x00, 0xE0, 0x00, 0x0F, 0x00, 0xE0, 0x00, 0x07, 0x00,
+    0xC0, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x03, 0x00,
+    0xC0, 0x00, 0x07, 0x00, 0xE0, 0x00, 0x0F, 0x00, 0xE0, 0x00, 0x0F, 0x00,
+    0xE0, 0x00, 0x0F, 0x00, 0xE0, 0x00, 0x0F, 0x00, 0xE0, 0x00, 0x0F, 0x00,
+    0xE0, 0x00, 0x0F, 0x00, 0xE0, 0x00, 0x0F, 0x00, 0xE0, 0x00, 0x0F, 0x00,
+    0xE0, 0x00, 0x0F, 0x00, 0xE0, 0x00, 0x0F, 0x00, 0xE0, 0x00, 0x0F, 0x00,
+    0xE0, 0x00, 0x0F, 0x00, 0xE0, 0x00, 0x0F, 0x00, 0xEF, 0xFF, 0xF7, 0x00,
+    0xDF, 0xFF, 0xFB, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFC, 0x00, // '0'
+    0x30, 0x70, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0,
+    0xF0, 0xF0, 0xF0, 0x70, 0x30, 0x00, 0x30, 0x70, 0xF0, 0xF0, 0xF0, 0xF0,
+    0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0x70, 0x30, // '1'
+    0x3F, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0xFB, 0x00,
+    0x0F, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0x00,
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0x00,
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0x00,
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0x00,
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x07, 0x00,
+    0x1F, 0xFF, 0xFB, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x9F, 0xFF, 0xF8, 0x00,
+    0xC0, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00,
+    0xE0, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00,
+    0xE0, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00,
+    0xE0, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00,
+    0xE0, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0xEF, 0xFF, 0xF0, 0x00,
+    0xDF, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFC, 0x00, // '2'
+    0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 0xEC, 0x3F, 0xFF, 0xDC,
+    0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C,
+    0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C,
+    0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C,
+    0x00, 0x00, 0x3C, 0x00, 0x00, 0x1C, 0x7F, 0xFF, 0xEC, 0xFF, 0xFF, 0xF0,
+    0x7F, 0xFF, 0xEC, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C,
+    0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C,
+    0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C,
+    0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x3F, 0xFF, 0xDC,
+    0x7F, 0xFF, 0xEC, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xF0, // '3'
+    0xC0, 0x00, 0x03, 0x00, 0xE0, 0x00, 0x07, 0x00, 0xE0, 0x00, 0x0F, 0x00,
+    0xE0, 0x00, 0x0F, 0x00, 0xE0, 0x00, 0x0F, 0x00, 0xE0, 0x00, 0x0F, 0x00,
+    0xE0, 0x00, 0x0F, 0x00, 0xE0, 0x00, 0x0F, 0x00, 0xE0, 0x00, 0x0F, 0x00,
+    0xE0, 0x00, 0x0F, 0x00, 0xE0, 0x00, 0x0F, 0x00, 0xE0, 0x00, 0x0F, 0x00,
+    0xE0, 0x00, 0x0F, 0x00, 0xE0, 0x00, 0x0F, 0x00, 0xE0, 0x00, 0x0F, 0x00,
+    0xE0, 0x00, 0x07, 0x00, 0xDF, 0xFF, 0xFB, 0x00, 0x3F, 0xFF, 0xFC, 0x00,
+    0x1F, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x0F, 0x00,
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0x00,
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0x00,
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0x00,
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0x00,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x03, 0x00, // '4'
+    0x3F, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0xDF, 0xFF, 0xF8, 0x00,
+    0xEF, 0xFF, 0xF0, 0x00, 0xE0, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00,
+    0xE0, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00,
+    0xE0, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00,
+    0xE0, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00,
+    0xE0, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00,
+    0xDF, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0xFB, 0x00,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0x00,
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0x00,
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0x00,
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0x00,
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x0F, 0xFF, 0xF7, 0x00,
+    0x1F, 0xFF, 0xFB, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFC, 0x00, // '5'
+    0x3F, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0xDF, 0xFF, 0xF8, 0x00,
+    0xEF, 0xFF, 0xF0, 0x00, 0xE0, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00,
+    0xE0, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00,
+    0xE0, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00,
+    0xE0, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00,
+    0xE0, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00,
+    0xDF, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x9F, 0xFF, 0xFB, 0x00,
+    0xC0, 0x00, 0x07, 0x00, 0xE0, 0x00, 0x0F, 0x00, 0xE0, 0x00, 0x0F, 0x00,
+    0xE0, 0x00, 0x0F, 0x00, 0xE0, 0x00, 0x0F, 0x00, 0xE0, 0x00, 0x0F, 0x00,
+    0xE0, 0x00, 0x0F, 0x00, 0xE0, 0x00, 0x0F, 0x00, 0xE0, 0x00, 0x0F, 0x00,
+    0xE0, 0x00, 0x0F, 0x00, 0xE0, 0x00, 0x0F, 0x00, 0xE0, 0x00, 0x0F, 0x00,
+    0xE0, 0x00, 0x0F, 0x00, 0xE0, 0x00, 0x0F, 0x00, 0xEF, 0xFF, 0xF7, 0x00,
+    0xDF, 0xFF, 0xFB, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFC, 0x00, // '6'
+    0x3F, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0xDF, 0xFF, 0xFB, 0x00,
+    0xEF, 0xFF, 0xF7, 0x00, 0xE0, 0x00, 0x0F, 0x00, 0xE0, 0x00, 0x0F, 0x00,
+    0xE0, 0x00, 0x0F, 0x00, 0xE0, 0x00, 0x0F, 0x00, 0xE0, 0x00, 0x0F, 0x00,
+    0xE0, 0x00, 0x0F, 0x00, 0xE0, 0x00, 0x0F, 0x00, 0xE0, 0x00, 0x0F, 0x00,
+    0xE0, 0x00, 0x0F, 0x00, 0xE0, 0x00, 0x0F, 0x00, 0xE0, 0x00, 0x0F, 0x00,
+    0xE0, 0x00, 0x0F, 0x00, 0xE0, 0x00, 0x0F, 0x00, 0xE0, 0x00, 0x07, 0x00,
+    0xC0, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0x00,
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0x00,
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0x00,
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0x00,
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x07, 0x00,
+    0x00, 0x00, 0x03, 0x00, // '7'
+    0x3F, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0xDF, 0xFF, 0xFB, 0x00,
+    0xEF, 0xFF, 0xF7, 0x00, 0xE0, 0x00, 0x0F, 0x00, 0xE0, 0x00, 0x0F, 0x00,
+    0xE0, 0x00, 0x0F, 0x00, 0xE0, 0x00, 0x0F, 0x00, 0xE0, 0x00, 0x0F, 0x00,
+    0xE0, 0x00, 0x0F, 0x00, 0xE0, 0x00, 0x0F, 0x00, 0xE0, 0x00, 0x0F, 0x00,
+    0xE0, 0x00, 0x0F, 0x00, 0xE0, 0x00, 0x0F, 0x00, 0xE0, 0x00, 0x0F, 0x00,
+    0xE0, 0x00, 0x0F, 0x00, 0xE0, 0x00, 0x0F, 0x00, 0xE0, 0x00, 0x07, 0x00,
+    0xDF, 0xFF, 0xFB, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x9F, 0xFF, 0xFB, 0x00,
+    0xC0, 0x00, 0x07, 0x00, 0xE0, 0x00, 0x0F, 0x00, 0xE0, 0x00, 0x0F, 0x00,
+    0xE0, 0x00, 0x0F, 0x00, 0xE0, 0x00, 0x0F, 0x00, 0xE0, 0x00, 0x0F, 0x00,
+    0xE0, 0x00, 0x0F, 0x00, 0xE0, 0x00, 0x0F, 0x00, 0xE0, 0x00, 0x0F, 0x00,
+    0xE0, 0x00, 0x0F, 0x00, 0xE0, 0x00, 0x0F, 0x00, 0xE0, 0x00, 0x0F, 0x00,
+    0xE0, 0x00, 0x0F, 0x00, 0xE0, 0x00, 0x0F, 0x00, 0xEF, 0xFF, 0xF7, 0x00,
+    0xDF, 0xFF, 0xFB, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFC, 0x00, // '8'
+    0x3F, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0xDF, 0xFF, 0xFB, 0x00,
+    0xEF, 0xFF, 0xF7, 0x00, 0xE0, 0x00, 0x0F, 0x00, 0xE0, 0x00, 0x0F, 0x00,
+    0xE0, 0x00, 0x0F, 0x00, 0xE0, 0x00, 0x0F, 0x00, 0xE0, 0x00, 0x0F, 0x00,
+    0xE0, 0x00, 0x0F, 0x00, 0xE0, 0x00, 0x0F, 0x00, 0xE0, 0x00, 0x0F, 0x00,
+    0xE0, 0x00, 0x0F, 0x00, 0xE0, 0x00, 0x0F, 0x00, 0xE0, 0x00, 0x0F, 0x00,
+    0xE0, 0x00, 0x0F, 0x00, 0xE0, 0x00, 0x0F, 0x00, 0xE0, 0x00, 0x07, 0x00,
+    0xDF, 0xFF, 0xFB, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0xFB, 0x00,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0x00,
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0x00,
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0x00,
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0x00,
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x0F, 0xFF, 0xF7, 0x00,
+    0x1F, 0xFF, 0xFB, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFC, 0x00, // '9'
+    0x78, 0x78, 0x78, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x78, 0x78, 0x78, 0x78, // ':'
+};
+const WatchyAtlasGlyph DSEG7_Classic_Regular_39AtlasGlyphs[] PROGMEM = {
+    // bitmapOffset, width, height, xAdvance, xOffset, yOffset
+    {0, 21, 3, 33, 6, -21}, // '-'
+    {9, 5, 5, 1, -2, -5}, // '.'
+    {14, 11, 26, 15, 1, -26}, // '/'
+    {66, 25, 39, 33, 4, -39}, // '0'
+    {222, 5, 35, 33, 24, -37}, // '1'
+    {257, 25, 39, 33, 4, -39}, // '2'
+    {413, 23, 39, 33, 6, -39}, // '3'
+    {530, 25, 35, 33, 4, -37}, // '4'
+    {670, 25, 39, 33, 4, -39}, // '5'
+    {826, 25, 39, 33, 4, -39}, // '6'
+    {982, 25, 37, 33, 4, -39}, // '7'
+    {1130, 25, 39, 33, 4, -39}, // '8'
+    {1286, 25, 39, 33, 4, -39}, // '9'
+    {1442, 6, 20, 9, 1, -29}  // ':'
+};
+const WatchyGlyphAtlas DSEG7_Classic_Regular_39Atlas PROGMEM = {
+    DSEG7_Classic_Regular_39AtlasBitmaps,
+    DSEG7_Classic_Regular_39AtlasGlyphs,
+    0x2D, 0x3A, 43};
+
+// Approx. 1586 bytes
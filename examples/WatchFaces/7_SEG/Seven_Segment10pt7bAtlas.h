@@ -0,0 +1,302 @@
+// Generated by extras/glyph_atlas.py from Seven_Segment10pt7b.h, ' ' to '~'.
+// Do not edit, rerun the script instead.
+const uint8_t Seven_Segment10pt7bAtlasBitmaps[] PROGMEM = {
+    0x00, // ' '
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, // '!'
+    0xA0, // '"'
+    0x09, 0x00, 0x0B, 0x00, 0x1A, 0x00, 0xFF, 0x80, 0x14, 0x00, 0xFF, 0x80,
+    0x2C, 0x00, 0x68, 0x00, 0x48, 0x00, // '#'
+    0x10, 0x10, 0x7E, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7E, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x7E, 0x10, 0x10, // '$'
+    0x00, 0x40, 0x00, 0x40, 0x70, 0x80, 0x88, 0x80, 0x89, 0x00, 0x8B, 0x00,
+    0x72, 0x00, 0x06, 0x60, 0x04, 0x90, 0x0C, 0x90, 0x08, 0x90, 0x10, 0x60,
+    0x30, 0x00, 0x20, 0x00, // '%'
+    0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x7E, 0x1F, 0x0F, 0x87, 0xE1, 0xF0, 0x80, 0x20, 0x10, 0x08, 0x12, 0x00,
+    0x80, 0x20, 0x10, 0x08, 0x12, 0x00, 0x80, 0x20, 0x10, 0x08, 0x12, 0x00,
+    0x80, 0x20, 0x10, 0x08, 0x12, 0x00, 0x80, 0x20, 0x10, 0x08, 0x12, 0x00,
+    0x80, 0x20, 0x10, 0x08, 0x12, 0x00, 0x7E, 0x20, 0x10, 0x07, 0xE2, 0x00, // '&'
+    0xFC, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84,
+    0x84, 0xFC, // '''
+    0x78, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x78, // '('
+    0xF0, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+    0x08, 0xF0, // ')'
+    0x20, 0x20, 0xF8, 0x70, 0xF8, 0xA8, 0x20, // '*'
+    0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0xFB, 0xE0,
+    0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, // '+'
+    0x40, 0x80, // ','
+    0xF8, // '-'
+    0x80, // '.'
+    0x01, 0x00, 0x01, 0x00, 0x03, 0x00, 0x02, 0x00, 0x06, 0x00, 0x04, 0x00,
+    0x0C, 0x00, 0x00, 0x00, 0x10, 0x00, 0x30, 0x00, 0x20, 0x00, 0x60, 0x00,
+    0x40, 0x00, 0x80, 0x00, // '/'
+    0x7E, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
+    0x81, 0x7E, // '0'
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, // '1'
+    0x7E, 0x01, 0x01, 0x01, 0x01, 0x01, 0x7E, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x7E, // '2'
+    0xF8, 0x04, 0x04, 0x04, 0x04, 0x04, 0xF8, 0x04, 0x04, 0x04, 0x04, 0x04,
+    0x04, 0xF8, // '3'
+    0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x7E, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, // '4'
+    0x7E, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7E, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x7E, // '5'
+    0x7E, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7E, 0x81, 0x81, 0x81, 0x81, 0x81,
+    0x81, 0x7E, // '6'
+    0xF8, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+    0x04, 0x04, // '7'
+    0x7E, 0x81, 0x81, 0x81, 0x81, 0x81, 0x7E, 0x81, 0x81, 0x81, 0x81, 0x81,
+    0x81, 0x7E, // '8'
+    0x7E, 0x81, 0x81, 0x81, 0x81, 0x81, 0x7E, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x7E, // '9'
+    0x80, 0x80, 0x00, 0x00, 0x80, 0x80, // ':'
+    0xFC, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84,
+    0x84, 0xFC, // ';'
+    0x20, 0x20, 0x40, 0x40, 0x40, 0x80, 0x80, 0x80, 0x80, 0x40, 0x40, 0x40,
+    0x20, 0x20, // '<'
+    0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, // '='
+    0x80, 0x80, 0x40, 0x40, 0x40, 0x20, 0x20, 0x20, 0x20, 0x40, 0x40, 0x40,
+    0x80, 0x80, // '>'
+    0x7E, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x7E, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, // '?'
+    0x7E, 0x81, 0x81, 0x81, 0x8F, 0x91, 0x91, 0x10, 0x91, 0x91, 0x8E, 0x80,
+    0x80, 0x7E, // '@'
+    0x7E, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x7E, 0x81, 0x81, 0x81, 0x81,
+    0x81, 0x81, // 'A'
+    0x7E, 0x81, 0x81, 0x81, 0x81, 0x81, 0x7E, 0x81, 0x81, 0x81, 0x81, 0x81,
+    0x81, 0x7E, // 'B'
+    0x7C, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x7C, // 'C'
+    0x7E, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
+    0x81, 0x7E, // 'D'
+    0x7C, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7C, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x7C, // 'E'
+    0x7C, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7C, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, // 'F'
+    0x7E, 0x80, 0x80, 0x80, 0x80, 0x80, 0x3E, 0x81, 0x81, 0x81, 0x81, 0x81,
+    0x81, 0x7E, // 'G'
+    0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x7E, 0x81, 0x81, 0x81, 0x81,
+    0x81, 0x81, // 'H'
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, // 'I'
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x81, 0x81, 0x81, 0x81, 0x81,
+    0x81, 0x7E, // 'J'
+    0x81, 0x86, 0x8C, 0x98, 0xB0, 0xA0, 0x7E, 0x81, 0x81, 0x81, 0x81, 0x81,
+    0x81, 0x81, // 'K'
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x7C, // 'L'
+    0x7B, 0xC0, 0x84, 0x20, 0x84, 0x20, 0x84, 0x20, 0x84, 0x20, 0x84, 0x20,
+    0x84, 0x20, 0x80, 0x20, 0x80, 0x20, 0x80, 0x20, 0x80, 0x20, 0x80, 0x20,
+    0x80, 0x20, 0x80, 0x20, // 'M'
+    0x7E, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
+    0x81, 0x81, // 'N'
+    0x7E, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
+    0x81, 0x7E, // 'O'
+    0x7E, 0x81, 0x81, 0x81, 0x81, 0x81, 0x7E, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, // 'P'
+    0x7E, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
+    0x83, 0x7F, // 'Q'
+    0x7E, 0x81, 0x81, 0x81, 0x81, 0x81, 0x7E, 0x80, 0xB0, 0x98, 0x8C, 0x86,
+    0x82, 0x81, // 'R'
+    0x7E, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7E, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x7E, // 'S'
+    0xF7, 0x80, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00,
+    0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00,
+    0x08, 0x00, 0x08, 0x00, // 'T'
+    0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
+    0x81, 0x7E, // 'U'
+    0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x42, 0x42, 0x66,
+    0x24, 0x24, // 'V'
+    0x80, 0x20, 0x80, 0x20, 0x80, 0x20, 0x80, 0x20, 0x80, 0x20, 0x80, 0x20,
+    0x80, 0x20, 0x84, 0x20, 0x84, 0x20, 0x84, 0x20, 0x84, 0x20, 0x84, 0x20,
+    0x84, 0x20, 0x7B, 0xC0, // 'W'
+    0x81, 0xC3, 0x42, 0x66, 0x24, 0x24, 0x00, 0x00, 0x24, 0x24, 0x66, 0x42,
+    0xC3, 0x81, // 'X'
+    0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x7E, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x7E, // 'Y'
+    0xFE, 0x02, 0x02, 0x06, 0x04, 0x0C, 0x08, 0x10, 0x30, 0x20, 0x60, 0x40,
+    0x40, 0x7F, // 'Z'
+    0x78, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x78, // '['
+    0x80, 0x00, 0xC0, 0x00, 0x40, 0x00, 0x20, 0x00, 0x30, 0x00, 0x10, 0x00,
+    0x10, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x06, 0x00, 0x02, 0x00, 0x03, 0x00,
+    0x01, 0x00, 0x01, 0x80, // '\\'
+    0xF0, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+    0x08, 0xF0, // ']'
+    0x06, 0xC0, 0x38, 0x78, 0xC0, 0x0C, // '^'
+    0xFF, 0xC0, // '_'
+    0xFC, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84,
+    0x84, 0xFC, // '`'
+    0x7E, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x7E, 0x81, 0x81, 0x81, 0x81,
+    0x81, 0x81, // 'a'
+    0x7E, 0x81, 0x81, 0x81, 0x81, 0x81, 0x7E, 0x81, 0x81, 0x81, 0x81, 0x81,
+    0x81, 0x7E, // 'b'
+    0x7C, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x7C, // 'c'
+    0x7E, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
+    0x81, 0x7E, // 'd'
+    0x7C, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7C, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x7C, // 'e'
+    0x7C, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7C, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, // 'f'
+    0x7E, 0x80, 0x80, 0x80, 0x80, 0x80, 0x3E, 0x81, 0x81, 0x81, 0x81, 0x81,
+    0x81, 0x7E, // 'g'
+    0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x7E, 0x81, 0x81, 0x81, 0x81,
+    0x81, 0x81, // 'h'
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, // 'i'
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x81, 0x81, 0x81, 0x81, 0x81,
+    0x81, 0x7E, // 'j'
+    0x81, 0x86, 0x8C, 0x98, 0xB0, 0xA0, 0x7E, 0x81, 0x81, 0x81, 0x81, 0x81,
+    0x81, 0x81, // 'k'
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x7C, // 'l'
+    0x7B, 0xC0, 0x84, 0x20, 0x84, 0x20, 0x84, 0x20, 0x84, 0x20, 0x84, 0x20,
+    0x84, 0x20, 0x80, 0x20, 0x80, 0x20, 0x80, 0x20, 0x80, 0x20, 0x80, 0x20,
+    0x80, 0x20, 0x80, 0x20, // 'm'
+    0x7E, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
+    0x81, 0x81, // 'n'
+    0x7E, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
+    0x81, 0x7E, // 'o'
+    0x7E, 0x81, 0x81, 0x81, 0x81, 0x81, 0x7E, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, // 'p'
+    0x7E, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
+    0x83, 0x7F, // 'q'
+    0x7E, 0x81, 0x81, 0x81, 0x81, 0x81, 0x7E, 0x80, 0xB0, 0x98, 0x8C, 0x86,
+    0x82, 0x81, // 'r'
+    0x7E, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7E, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x7E, // 's'
+    0xF7, 0x80, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00,
+    0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00,
+    0x08, 0x00, 0x08, 0x00, // 't'
+    0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
+    0x81, 0x7E, // 'u'
+    0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x42, 0x42, 0x66,
+    0x24, 0x24, // 'v'
+    0x80, 0x20, 0x80, 0x20, 0x80, 0x20, 0x80, 0x20, 0x80, 0x20, 0x80, 0x20,
+    0x80, 0x20, 0x84, 0x20, 0x84, 0x20, 0x84, 0x20, 0x84, 0x20, 0x84, 0x20,
+    0x84, 0x20, 0x7B, 0xC0, // 'w'
+    0x81, 0xC3, 0x42, 0x66, 0x24, 0x24, 0x00, 0x00, 0x24, 0x24, 0x66, 0x42,
+    0xC3, 0x81, // 'x'
+    0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x7E, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x7E, // 'y'
+    0xFE, 0x02, 0x02, 0x06, 0x04, 0x0C, 0x08, 0x10, 0x30, 0x20, 0x60, 0x40,
+    0x40, 0x7F, // 'z'
+    0x1E, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0xC0, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x1E, // '{'
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, // '|'
+    0xF0, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x06, 0x08, 0x08, 0x08, 0x08,
+    0x08, 0xF0, // '}'
+    0xFC, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84,
+    0x84, 0xFC, // '~'
+};
+const WatchyAtlasGlyph Seven_Segment10pt7bAtlasGlyphs[] PROGMEM = {
+    // bitmapOffset, width, height, xAdvance, xOffset, yOffset
+    {0, 1, 1, 6, 0, 0}, // ' '
+    {1, 1, 14, 4, 1, -13}, // '!'
+    {15, 3, 1, 6, 1, -12}, // '"'
+    {16, 9, 9, 11, 1, -8}, // '#'
+    {34, 8, 18, 10, 1, -15}, // '$'
+    {52, 12, 14, 14, 1, -13}, // '%'
+    {80, 44, 14, 47, 1, -13}, // '&'
+    {164, 6, 14, 7, 1, -13}, // '''
+    {178, 5, 14, 8, 1, -13}, // '('
+    {192, 5, 14, 8, 1, -13}, // ')'
+    {206, 5, 7, 8, 2, -16}, // '*'
+    {213, 11, 11, 13, 1, -11}, // '+'
+    {235, 2, 2, 5, 1, -1}, // ','
+    {237, 5, 1, 8, 1, -6}, // '-'
+    {238, 1, 1, 4, 1, 0}, // '.'
+    {239, 9, 14, 11, 1, -13}, // '/'
+    {267, 8, 14, 10, 1, -13}, // '0'
+    {281, 1, 14, 4, 1, -13}, // '1'
+    {295, 8, 14, 10, 1, -13}, // '2'
+    {309, 6, 14, 9, 2, -13}, // '3'
+    {323, 8, 14, 10, 1, -13}, // '4'
+    {337, 8, 14, 10, 1, -13}, // '5'
+    {351, 8, 14, 10, 1, -13}, // '6'
+    {365, 6, 14, 9, 2, -13}, // '7'
+    {379, 8, 14, 10, 1, -13}, // '8'
+    {393, 8, 14, 10, 1, -13}, // '9'
+    {407, 1, 6, 4, 1, -5}, // ':'
+    {413, 6, 14, 7, 1, -13}, // ';'
+    {427, 3, 14, 6, 1, -13}, // '<'
+    {441, 9, 5, 11, 1, -7}, // '='
+    {451, 3, 14, 6, 1, -13}, // '>'
+    {465, 8, 14, 10, 1, -13}, // '?'
+    {479, 8, 14, 10, 1, -13}, // '@'
+    {493, 8, 14, 10, 1, -13}, // 'A'
+    {507, 8, 14, 10, 1, -13}, // 'B'
+    {521, 6, 14, 9, 1, -13}, // 'C'
+    {535, 8, 14, 10, 1, -13}, // 'D'
+    {549, 6, 14, 9, 1, -13}, // 'E'
+    {563, 6, 14, 9, 1, -13}, // 'F'
+    {577, 8, 14, 10, 1, -13}, // 'G'
+    {591, 8, 14, 10, 1, -13}, // 'H'
+    {605, 1, 14, 4, 1, -13}, // 'I'
+    {619, 8, 14, 10, 1, -13}, // 'J'
+    {633, 8, 14, 10, 1, -13}, // 'K'
+    {647, 6, 14, 9, 1, -13}, // 'L'
+    {661, 11, 14, 14, 1, -13}, // 'M'
+    {689, 8, 14, 10, 1, -13}, // 'N'
+    {703, 8, 14, 10, 1, -13}, // 'O'
+    {717, 8, 14, 10, 1, -13}, // 'P'
+    {731, 8, 14, 10, 1, -13}, // 'Q'
+    {745, 8, 14, 10, 1, -13}, // 'R'
+    {759, 8, 14, 10, 1, -13}, // 'S'
+    {773, 9, 14, 12, 1, -13}, // 'T'
+    {801, 8, 14, 10, 1, -13}, // 'U'
+    {815, 8, 14, 10, 1, -13}, // 'V'
+    {829, 11, 14, 14, 1, -13}, // 'W'
+    {857, 8, 14, 10, 1, -13}, // 'X'
+    {871, 8, 14, 10, 1, -13}, // 'Y'
+    {885, 8, 14, 10, 1, -13}, // 'Z'
+    {899, 5, 14, 8, 1, -13}, // '['
+    {913, 9, 14, 11, 1, -13}, // '\\'
+    {941, 5, 14, 8, 1, -13}, // ']'
+    {955, 14, 3, 16, 1, -8}, // '^'
+    {961, 10, 1, 12, 1, 0}, // '_'
+    {963, 6, 14, 7, 1, -13}, // '`'
+    {977, 8, 14, 10, 1, -13}, // 'a'
+    {991, 8, 14, 10, 1, -13}, // 'b'
+    {1005, 6, 14, 9, 1, -13}, // 'c'
+    {1019, 8, 14, 10, 1, -13}, // 'd'
+    {1033, 6, 14, 9, 1, -13}, // 'e'
+    {1047, 6, 14, 9, 1, -13}, // 'f'
+    {1061, 8, 14, 10, 1, -13}, // 'g'
+    {1075, 8, 14, 10, 1, -13}, // 'h'
+    {1089, 1, 14, 4, 1, -13}, // 'i'
+    {1103, 8, 14, 10, 1, -13}, // 'j'
+    {1117, 8, 14, 10, 1, -13}, // 'k'
+    {1131, 6, 14, 9, 1, -13}, // 'l'
+    {1145, 11, 14, 14, 1, -13}, // 'm'
+    {1173, 8, 14, 10, 1, -13}, // 'n'
+    {1187, 8, 14, 10, 1, -13}, // 'o'
+    {1201, 8, 14, 10, 1, -13}, // 'p'
+    {1215, 8, 14, 10, 1, -13}, // 'q'
+    {1229, 8, 14, 10, 1, -13}, // 'r'
+    {1243, 8, 14, 10, 1, -13}, // 's'
+    {1257, 9, 14, 12, 1, -13}, // 't'
+    {1285, 8, 14, 10, 1, -13}, // 'u'
+    {1299, 8, 14, 10, 1, -13}, // 'v'
+    {1313, 11, 14, 14, 1, -13}, // 'w'
+    {1341, 8, 14, 10, 1, -13}, // 'x'
+    {1355, 8, 14, 10, 1, -13}, // 'y'
+    {1369, 8, 14, 10, 1, -13}, // 'z'
+    {1383, 7, 14, 10, 1, -13}, // '{'
+    {1397, 1, 16, 4, 1, -15}, // '|'
+    {1413, 7, 14, 10, 1, -13}, // '}'
+    {1427, 6, 14, 7, 1, -13}  // '~'
+};
+const WatchyGlyphAtlas Seven_Segment10pt7bAtlas PROGMEM = {
+    Seven_Segment10pt7bAtlasBitmaps,
+    Seven_Segment10pt7bAtlasGlyphs,
+    0x20, 0x7E, 20};
+
+// Approx. 2213 bytes
@@ -23,52 +23,42 @@ void Watchy7SEG::drawWatchFace(){
 }
 
 void Watchy7SEG::drawTime(){
-    display.setFont(&DSEG7_Classic_Bold_53);
-    display.setCursor(5, 53+5);
     int displayHour;
     if(HOUR_12_24==12){
       displayHour = ((currentTime.Hour+11)%12)+1;
     } else {
       displayHour = currentTime.Hour;
     }
-    if(displayHour < 10){
-        display.print("0");
-    }
-    display.print(displayHour);
-    display.print(":");
-    if(currentTime.Minute < 10){
-        display.print("0");
-    }
-    display.println(currentTime.Minute);
+    char time[6];
+    snprintf(time, sizeof(time), "%02d:%02d", displayHour, currentTime.Minute);
+    display.setCursor(5, 53+5);
+    display.printAtlas(&DSEG7_Classic_Bold_53Atlas, time);
 }
 
 void Watchy7SEG::drawDate(){
-    display.setFont(&Seven_Segment10pt7b);
-
     int16_t  x1, y1;
     uint16_t w, h;
 
-    String dayOfWeek = dayStr(currentTime.Wday);
-    display.getTextBounds(dayOfWeek, 5, 85, &x1, &y1, &w, &h);
+    const char *dayOfWeek = dayStr(currentTime.Wday);
+    display.getAtlasTextBounds(&Seven_Segment10pt7bAtlas, dayOfWeek, 5, 85, &x1, &y1, &w, &h);
     if(currentTime.Wday == 4){
         w = w - 5;
     }
     display.setCursor(85 - w, 85);
-    display.println(dayOfWeek);
+    display.printAtlas(&Seven_Segment10pt7bAtlas, dayOfWeek);
 
-    String month = monthShortStr(currentTime.Month);
-    display.getTextBounds(month, 60, 110, &x1, &y1, &w, &h);
+    const char *month = monthShortStr(currentTime.Month);
+    display.getAtlasTextBounds(&Seven_Segment10pt7bAtlas, month, 60, 110, &x1, &y1, &w, &h);
     display.setCursor(85 - w, 110);
-    display.println(month);
+    display.printAtlas(&Seven_Segment10pt7bAtlas, month);
 
-    display.setFont(&DSEG7_Classic_Bold_25);
+    char number[8];
+    snprintf(number, sizeof(number), "%02d", currentTime.Day);
     display.setCursor(5, 120);
-    if(currentTime.Day < 10){
-    display.print("0");
-    }
-    display.println(currentTime.Day);
+    display.printAtlas(&DSEG7_Classic_Bold_25Atlas, number);
+    snprintf(number, sizeof(number), "%d", tmYearToCalendar(currentTime.Year));// offset from 1970, since year is stored in uint8_t
     display.setCursor(5, 150);
-    display.println(tmYearToCalendar(currentTime.Year));// offset from 1970, since year is stored in uint8_t
+    display.printAtlas(&DSEG7_Classic_Bold_25Atlas, number);
 }
 void Watchy7SEG::drawSteps(){
     // reset step counter at midnight
@@ -77,8 +67,10 @@ void Watchy7SEG::drawSteps(){
     }
     uint32_t stepCount = sensor.getCounter();
     display.drawBitmap(10, 165, steps, 19, 23, DARKMODE ? GxEPD_WHITE : GxEPD_BLACK);
+    char count[11];
+    snprintf(count, sizeof(count), "%u", stepCount);
     display.setCursor(35, 190);
-    display.println(stepCount);
+    display.printAtlas(&DSEG7_Classic_Bold_25Atlas, count);
 }
 void Watchy7SEG::drawBattery(){
     display.drawBitmap(154, 73, battery, 37, 21, DARKMODE ? GxEPD_WHITE : GxEPD_BLACK);
@@ -110,18 +102,20 @@ void Watchy7SEG::drawWeather(){
     int8_t temperature = currentWeather.temperature;
     int16_t weatherConditionCode = currentWeather.weatherConditionCode;
 
-    display.setFont(&DSEG7_Classic_Regular_39);
+    char number[5];
+    snprintf(number, sizeof(number), "%d", temperature);
+    const WatchyGlyphAtlas *atlas = &DSEG7_Classic_Regular_39Atlas;
     int16_t  x1, y1;
     uint16_t w, h;
-    display.getTextBounds(String(temperature), 0, 0, &x1, &y1, &w, &h);
+    display.getAtlasTextBounds(atlas, number, 0, 0, &x1, &y1, &w, &h);
     if(159 - w - x1 > 87){
         display.setCursor(159 - w - x1, 150);
     }else{
-        display.setFont(&DSEG7_Classic_Bold_25);
-        display.getTextBounds(String(temperature), 0, 0, &x1, &y1, &w, &h);
+        atlas = &DSEG7_Classic_Bold_25Atlas;
+        display.getAtlasTextBounds(atlas, number, 0, 0, &x1, &y1, &w, &h);
         display.setCursor(159 - w - x1, 136);
     }
-    display.println(temperature);
+    display.printAtlas(atlas, number);
     display.drawBitmap(165, 110, currentWeather.isMetric ? celsius : fahrenheit, 26, 20, DARKMODE ? GxEPD_WHITE : GxEPD_BLACK);
     const unsigned char* weatherIcon;
 
@@ -2,10 +2,10 @@
 #define WATCHY_7_SEG_H
 
 #include <Watchy.h>
-#include "Seven_Segment10pt7b.h"
 #include "DSEG7_Classic_Regular_15.h"
-#include "DSEG7_Classic_Bold_25.h"
-#include "DSEG7_Classic_Regular_39.h"
+#include "Seven_Segment10pt7bAtlas.h"
+#include "DSEG7_Classic_Bold_25Atlas.h"
+#include "DSEG7_Classic_Regular_39Atlas.h"
 #include "icons.h"
 
 class Watchy7SEG : public Watchy{
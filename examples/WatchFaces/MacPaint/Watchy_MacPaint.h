@@ -8,6 +8,7 @@ class WatchyMacPaint : public Watchy{
     using Watchy::Watchy;
     public:
         void drawWatchFace();
+        const uint8_t *getBackgroundBitmap();
 };
 
 #endif
\ No newline at end of file
@@ -0,0 +1,10 @@
+#include "Watchy_Seconds.h"
+#include "settings.h"
+
+WatchySeconds watchy(settings);
+
+void setup(){
+  watchy.init();
+}
+
+void loop(){}
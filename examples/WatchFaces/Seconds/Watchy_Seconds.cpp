@@ -0,0 +1,25 @@
+#include "Watchy_Seconds.h"
+
+void WatchySeconds::drawWatchFace(){
+    Watchy::drawWatchFace();
+    drawSeconds();
+}
+
+secondsWindow WatchySeconds::getSecondsWindow(){
+    return {136, 160, 64, 32};
+}
+
+void WatchySeconds::drawSeconds(){
+    char seconds[4];
+    snprintf(seconds, sizeof(seconds), ":%02u", currentTime.Second);
+    display.fillRect(136, 160, 64, 32, GxEPD_WHITE);
+    display.setFont(&FreeMonoBold9pt7b);
+    display.setTextColor(GxEPD_BLACK);
+    display.setCursor(150, 182);
+    display.print(seconds);
+}
+
+// 59 small updates a minute, clean the panel every few minutes instead
+refreshPolicy WatchySeconds::getRefreshPolicy(){
+    return {300, REFRESH_PIXELS, 600};
+}
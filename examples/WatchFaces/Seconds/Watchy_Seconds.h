@@ -0,0 +1,15 @@
+#ifndef WATCHY_SECONDS_H
+#define WATCHY_SECONDS_H
+
+#include <Watchy.h>
+
+class WatchySeconds : public Watchy{
+    using Watchy::Watchy;
+    public:
+        void drawWatchFace();
+        secondsWindow getSecondsWindow();
+        void drawSeconds();
+        refreshPolicy getRefreshPolicy();
+};
+
+#endif
@@ -2,10 +2,11 @@
 
 const unsigned char *tetris_nums [10] = {tetris0, tetris1, tetris2, tetris3, tetris4, tetris5, tetris6, tetris7, tetris8, tetris9};
 
-void WatchyTetris::drawWatchFace(){
-    display.fillScreen(GxEPD_WHITE);
-    display.drawBitmap(0, 0, tetrisbg, DISPLAY_WIDTH, DISPLAY_HEIGHT, GxEPD_BLACK);
+const uint8_t *WatchyTetris::getBackgroundBitmap(){
+    return tetrisbg;
+}
 
+void WatchyTetris::drawWatchFace(){
     //Hour
     display.drawBitmap(25, 20, tetris_nums[currentTime.Hour/10], 40, 60, GxEPD_BLACK); //first digit
     display.drawBitmap(75, 20, tetris_nums[currentTime.Hour%10], 40, 60, GxEPD_BLACK); //second digit
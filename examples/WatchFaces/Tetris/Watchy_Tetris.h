@@ -8,6 +8,7 @@ class WatchyTetris : public Watchy{
     public:
         using Watchy::Watchy;
         void drawWatchFace();
+        const uint8_t *getBackgroundBitmap();
 };
 
 #endif
\ No newline at end of file
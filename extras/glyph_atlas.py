@@ -0,0 +1,134 @@
+#!/usr/bin/env python3
+"""Pre-rasterizes an Adafruit GFXfont header into a WatchyGlyphAtlas header.
+
+GFXfont bitmaps are bit-packed across rows, so every glyph has to be decoded
+a pixel at a time. The atlas stores each glyph with its rows padded to whole
+bytes, which lets WatchyDisplay::printAtlas() hand them straight to the
+drawBitmap blitter. Metrics (advance, offsets, size) are copied unchanged,
+so atlas text lands on exactly the same pixels as the GFXfont it came from.
+
+usage: glyph_atlas.py FONT.h [--first C] [--last C] [-o OUT.h]
+
+The default range '-' to ':' covers digits, ':', '.', '/' and a minus sign.
+"""
+
+import argparse
+import os
+import re
+import sys
+
+
+def strip_comments(text):
+    return re.sub(r"//[^\n]*", "", text)
+
+
+def block(text, pattern):
+    match = re.search(pattern + r"\s*=\s*\{(.*?)\};", text, re.S)
+    if not match:
+        sys.exit("glyph_atlas: no match for " + pattern)
+    return strip_comments(match.group(1))
+
+
+def parse_font(text):
+    font = re.search(r"const\s+GFXfont\s+(\w+)\s+PROGMEM\s*=\s*\{(.*?)\}", text,
+                     re.S)
+    if not font:
+        sys.exit("glyph_atlas: no GFXfont found")
+    name = font.group(1)
+    fields = [f.strip() for f in strip_comments(font.group(2)).split(",")]
+    first, last, y_advance = (int(f, 0) for f in fields[-3:])
+    bitmaps = [int(b, 16) for b in re.findall(
+        r"0x[0-9A-Fa-f]+", block(text, r"\w+Bitmaps\[\]\s+PROGMEM"))]
+    glyphs = [tuple(int(v) for v in g) for g in re.findall(
+        r"\{\s*(-?\d+)\s*,\s*(-?\d+)\s*,\s*(-?\d+)\s*,\s*(-?\d+)\s*,"
+        r"\s*(-?\d+)\s*,\s*(-?\d+)\s*\}",
+        block(text, r"GFXglyph\s+\w+Glyphs\[\]\s+PROGMEM"))]
+    return name, bitmaps, glyphs, first, last, y_advance
+
+
+def rasterize(bitmaps, offset, width, height):
+    """Returns the glyph as rows of whole bytes, MSB first."""
+    rows = []
+    bit = offset * 8
+    for _ in range(height):
+        row = [0] * ((width + 7) // 8)
+        for x in range(width):
+            if bitmaps[bit >> 3] & (0x80 >> (bit & 7)):
+                row[x >> 3] |= 0x80 >> (x & 7)
+            bit += 1
+        rows.append(row)
+    return rows
+
+
+def char_name(code):
+    return "'\\\\'" if code == 0x5C else "'%c'" % code
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("font")
+    parser.add_argument("--first", default="-")
+    parser.add_argument("--last", default=":")
+    parser.add_argument("-o", "--output")
+    args = parser.parse_args()
+
+    with open(args.font) as f:
+        name, bitmaps, glyphs, font_first, font_last, y_advance = parse_font(
+            f.read())
+    first, last = ord(args.first), ord(args.last)
+    if first < font_first or last > font_last or first > last:
+        sys.exit("glyph_atlas: range outside of %s" % name)
+
+    data, entries = [], []
+    for code in range(first, last + 1):
+        offset, width, height, x_advance, x_offset, y_offset = glyphs[
+            code - font_first]
+        rows = rasterize(bitmaps, offset, width, height)
+        entries.append((len(data), width, height, x_advance, x_offset,
+                        y_offset, code))
+        data.append((code, [b for row in rows for b in row]))
+    total = sum(len(d[1]) for d in data)
+    if total > 0xFFFF:
+        sys.exit("glyph_atlas: atlas larger than 64 KB, narrow the range")
+
+    out = []
+    out.append("// Generated by extras/glyph_atlas.py from %s, %s to %s."
+               % (os.path.basename(args.font), char_name(first),
+                  char_name(last)))
+    out.append("// Do not edit, rerun the script instead.")
+    out.append("const uint8_t %sAtlasBitmaps[] PROGMEM = {" % name)
+    for code, glyph in data:
+        for i in range(0, len(glyph), 12):
+            line = ", ".join("0x%02X" % b for b in glyph[i:i + 12]) + ","
+            if i + 12 >= len(glyph):
+                line += " // " + char_name(code)
+            out.append("    " + line)
+    out.append("};")
+    out.append("const WatchyAtlasGlyph %sAtlasGlyphs[] PROGMEM = {" % name)
+    out.append("    // bitmapOffset, width, height, xAdvance, xOffset, yOffset")
+    offset = 0
+    for i, (_, width, height, x_advance, x_offset, y_offset, code) in \
+            enumerate(entries):
+        out.append("    {%d, %d, %d, %d, %d, %d}%s // %s" % (
+            offset, width, height, x_advance, x_offset, y_offset,
+            "," if i + 1 < len(entries) else " ", char_name(code)))
+        offset += len(data[i][1])
+    out.append("};")
+    out.append("const WatchyGlyphAtlas %sAtlas PROGMEM = {" % name)
+    out.append("    %sAtlasBitmaps," % name)
+    out.append("    %sAtlasGlyphs," % name)
+    out.append("    0x%02X, 0x%02X, %d};" % (first, last, y_advance))
+    out.append("")
+    out.append("// Approx. %d bytes" % (total + 8 * len(entries) + 12))
+    out.append("")
+
+    text = "\n".join(out)
+    if args.output:
+        with open(args.output, "w") as f:
+            f.write(text)
+    else:
+        sys.stdout.write(text)
+
+
+if __name__ == "__main__":
+    main()
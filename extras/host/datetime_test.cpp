@@ -0,0 +1,145 @@
+// Host tests for WatchyRTC::parseDateTime(), the string init() and
+// RTC.config() take to set the clock. Run with `make test`.
+#include <Arduino.h>
+#include "WatchyRTC.h"
+
+static int failures;
+
+// sentinel fields, so a rejected string can be seen to leave tm alone
+static tmElements_t untouched() {
+  tmElements_t tm;
+  tm.Year   = 99;
+  tm.Month  = 99;
+  tm.Day    = 99;
+  tm.Hour   = 99;
+  tm.Minute = 99;
+  tm.Second = 99;
+  tm.Wday   = 99;
+  return tm;
+}
+
+static void accepts(const char *datetime, int year, int month, int day,
+                    int hour, int minute, int second) {
+  tmElements_t tm = untouched();
+  if (!WatchyRTC::parseDateTime(datetime, tm)) {
+    printf("FAIL \"%s\" rejected\n", datetime);
+    failures++;
+  } else if (tmYearToCalendar(tm.Year) != year || tm.Month != month ||
+             tm.Day != day || tm.Hour != hour || tm.Minute != minute ||
+             tm.Second != second) {
+    printf("FAIL \"%s\" read as %04d-%02d-%02d %02d:%02d:%02d\n", datetime,
+           tmYearToCalendar(tm.Year), tm.Month, tm.Day, tm.Hour, tm.Minute,
+           tm.Second);
+    failures++;
+  }
+}
+
+static void rejects(const char *datetime) {
+  tmElements_t tm = untouched();
+  tmElements_t before = tm;
+  if (WatchyRTC::parseDateTime(datetime, tm)) {
+    printf("FAIL \"%s\" accepted\n", datetime);
+    failures++;
+  } else if (memcmp(&tm, &before, sizeof(tm)) != 0) {
+    printf("FAIL \"%s\" rejected but changed tm\n", datetime);
+    failures++;
+  }
+}
+
+int main() {
+  // YYYY:MM:DD:HH:MM:SS
+  accepts("2026:10:17:09:30:00", 2026, 10, 17, 9, 30, 0);
+  accepts("2000:01:01:00:00:00", 2000, 1, 1, 0, 0, 0);
+  accepts("2099:12:31:23:59:59", 2099, 12, 31, 23, 59, 59);
+
+  // ISO-8601
+  accepts("2026-10-17T09:30:00", 2026, 10, 17, 9, 30, 0);
+  accepts("2026-10-17 09:30:45", 2026, 10, 17, 9, 30, 45);
+  accepts("2026-10-17T09:30", 2026, 10, 17, 9, 30, 0);
+  accepts("2026-10-17T09:30:00Z", 2026, 10, 17, 9, 30, 0);
+  accepts("2026-10-17T09:30:00.123Z", 2026, 10, 17, 9, 30, 0);
+  accepts("2026-10-17T09:30:00,5", 2026, 10, 17, 9, 30, 0);
+  accepts("2026-10-17T09:30:00+02:00", 2026, 10, 17, 9, 30, 0);
+  accepts("2026-10-17T09:30:00-0530", 2026, 10, 17, 9, 30, 0);
+  accepts("2026-10-17T09:30:00+02", 2026, 10, 17, 9, 30, 0);
+
+  // __DATE__ " " __TIME__, single digit days are padded with a space
+  accepts("Oct 17 2026 09:30:00", 2026, 10, 17, 9, 30, 0);
+  accepts("Feb  7 2028 23:05:09", 2028, 2, 7, 23, 5, 9);
+  accepts("Jan  1 2000 00:00:00", 2000, 1, 1, 0, 0, 0);
+  tmElements_t tm;
+  if (!WatchyRTC::parseDateTime(__DATE__ " " __TIME__, tm)) {
+    printf("FAIL this build's \"%s\" rejected\n", __DATE__ " " __TIME__);
+    failures++;
+  }
+
+  // leap days, 2000 is a leap year and 2100 is out of range anyway
+  accepts("2000-02-29T12:00", 2000, 2, 29, 12, 0, 0);
+  accepts("2028:02:29:12:00:00", 2028, 2, 29, 12, 0, 0);
+  rejects("2026-02-29T12:00");
+  rejects("Feb 29 2027 12:00:00");
+
+  // empty, and cut short anywhere
+  rejects("");
+  rejects("2026");
+  rejects("2026-10");
+  rejects("2026-10-17");
+  rejects("2026-10-17T");
+  rejects("2026-10-17T09");
+  rejects("2026-10-17T09:");
+  rejects("2026-10-17T09:30:");
+  rejects("2026:10:17");
+  rejects("2026:10:17:09");
+  rejects("Oct");
+  rejects("Oct 17");
+  rejects("Oct 17 2026");
+  rejects("Oct 17 2026 ");
+
+  // malformed
+  rejects(" 2026-10-17T09:30:00");
+  rejects("2026-10-17T09:30:00 ");
+  rejects("2026-10-17T09:30:00junk");
+  rejects("2026-10-17X09:30:00");
+  rejects("2026:10-17:09:30:00");
+  rejects("2026-10:17T09:30:00");
+  rejects("2026:10:17T09:30:00");
+  rejects("2026:10:17:09:30:00Z"); // suffixes are ISO-8601 only
+  rejects("20261-10-17T09:30:00");
+  rejects("2026-100-17T09:30:00");
+  rejects("2026-10-17T09:30:000");
+  rejects("2026-10-17T09:30:00+");
+  rejects("2026-10-17T09:30:00+02:");
+  rejects("2026-10-17T09:30:00+020000");
+  rejects("2026/10/17 09:30:00");
+  rejects("oct 17 2026 09:30:00");
+  rejects("Foo 17 2026 09:30:00");
+  rejects("October 17 2026 09:30:00");
+  rejects("Oct 17 26 09:30:00x");
+  rejects("Oct-17-2026 09:30:00");
+  rejects("-2026-10-17T09:30:00");
+  rejects("2026--10-17T09:30:00");
+
+  // out of range fields
+  rejects("1999-12-31T23:59:59");
+  rejects("2100-01-01T00:00:00");
+  rejects("0000:01:01:00:00:00");
+  rejects("2026-00-17T09:30:00");
+  rejects("2026-13-17T09:30:00");
+  rejects("2026-10-00T09:30:00");
+  rejects("2026-10-32T09:30:00");
+  rejects("2026-04-31T09:30:00");
+  rejects("2026-10-17T24:00:00");
+  rejects("2026-10-17T09:60:00");
+  rejects("2026-10-17T09:30:60");
+  rejects("Oct 32 2026 09:30:00");
+  rejects("Oct  0 2026 09:30:00");
+  rejects("Oct 17 1999 09:30:00");
+  rejects("Oct 17 2026 25:30:00");
+
+  if (failures) {
+    printf("%d parseDateTime checks failed\n", failures);
+    return 1;
+  }
+  printf("parseDateTime checks passed\n");
+  return 0;
+}
@@ -0,0 +1,231 @@
+// Host tests for WatchyJSON, the extractor getWeatherData() streams the
+// OpenWeatherMap response through. The responses in payloads/ are replayed
+// the way the HTTP stream hands them over, checked, and timed: the time per
+// parse and how many bytes it took to find the fields are printed for each.
+// Run with `make test`, or build/json_test <payload directory>.
+#include <Arduino.h>
+#include <dirent.h>
+#include <string>
+#include <vector>
+#include "WatchyJSON.h"
+
+// the fields getWeatherData() asks for
+static const char *const weatherFields[] = {"main.temp", "weather[0].id",
+                                            "weather[0].main"};
+
+// A response body, or the first length bytes of one if the connection
+// dropped there
+class ReplayStream : public Stream {
+public:
+  ReplayStream(const std::string &body, size_t length = std::string::npos)
+      : _body(body), _length(min(length, body.size())), _position(0) {}
+  int available() { return _length - _position; }
+  int read() {
+    return _position < _length ? (uint8_t)_body[_position++] : -1;
+  }
+  size_t write(uint8_t) { return 0; }
+  size_t position() { return _position; }
+
+private:
+  const std::string &_body;
+  size_t _length;
+  size_t _position;
+};
+
+static int failures;
+
+static void check(bool ok, const char *what, const char *detail = "") {
+  if (!ok) {
+    printf("FAIL %s %s\n", what, detail);
+    failures++;
+  }
+}
+
+static bool readFile(const std::string &path, std::string &body) {
+  FILE *file = fopen(path.c_str(), "rb");
+  if (file == NULL) {
+    return false;
+  }
+  char buffer[256];
+  for (size_t n; (n = fread(buffer, 1, sizeof(buffer), file)) > 0;) {
+    body.append(buffer, n);
+  }
+  fclose(file);
+  return true;
+}
+
+// Feeds the body byte by byte, returns how many bytes it took to be done
+static size_t feedUntilDone(WatchyJSON &json, const std::string &body) {
+  size_t n = 0;
+  while (n < body.size() && !json.done()) {
+    json.feed(body[n++]);
+  }
+  return n;
+}
+
+// Every field the document has is found with the text it has there, the
+// parse stops right after the last of them, and a body cut anywhere before
+// that point is never taken as complete
+static void replay(const char *name, const std::string &body) {
+  std::string expected[3];
+  bool present[3];
+  size_t last = 0; // bytes up to the end of the last field
+  for (uint8_t i = 0; i < 3; i++) {
+    WatchyJSON single(&weatherFields[i], 1);
+    size_t n   = feedUntilDone(single, body);
+    present[i] = single.complete();
+    if (present[i]) {
+      expected[i] = single.value(0);
+      last        = max(last, n);
+    }
+  }
+  bool all = present[0] && present[1] && present[2];
+
+  WatchyJSON fed(weatherFields, 3);
+  size_t stop = feedUntilDone(fed, body);
+  check(!all || stop == last, name, "did not stop after the last field");
+
+  WatchyJSON response(weatherFields, 3);
+  ReplayStream stream(body);
+  check(response.parse(stream) == all, name, "complete() is wrong");
+  for (uint8_t i = 0; i < 3; i++) {
+    check(response.found(i) == present[i], name, weatherFields[i]);
+    check(expected[i] == response.value(i), name, weatherFields[i]);
+  }
+
+  for (size_t cut = 0; cut < body.size(); cut++) {
+    WatchyJSON truncated(weatherFields, 3);
+    ReplayStream partial(body, cut);
+    if (truncated.parse(partial) != (all && cut >= stop)) {
+      char detail[48];
+      snprintf(detail, sizeof(detail), "cut at byte %u", (unsigned)cut);
+      check(false, name, detail);
+      break;
+    }
+  }
+
+  const uint32_t runs = 20000;
+  uint32_t start      = micros();
+  for (uint32_t i = 0; i < runs; i++) {
+    WatchyJSON timed(weatherFields, 3);
+    ReplayStream replayed(body);
+    timed.parse(replayed);
+  }
+  float perParse = (float)(micros() - start) / runs;
+
+  // parse() reads in chunks of up to 64 bytes, so it takes a little more
+  // off the stream than the bytes it needed
+  printf("%-26s %4u of %4u bytes (%4u read)  %5.2f us  ", name,
+         (unsigned)stop, (unsigned)body.size(), (unsigned)stream.position(),
+         perParse);
+  if (all) {
+    printf("%s %s %s\n", response.value(0), response.value(1),
+           response.value(2));
+  } else {
+    printf("incomplete\n");
+  }
+}
+
+struct jsonCase {
+  const char *json;
+  const char *values[3]; // NULL if the field must not be found
+};
+
+// Hand written documents for what the recorded responses do not show
+static const jsonCase cases[] = {
+    // escapes in the captured value are reduced to the escaped character,
+    // \u sequences are not decoded
+    {R"({"weather":[{"id":800,"main":"a\"b\\c\/d"}],"main":{"temp":1}})",
+     {"1", "800", "a\"b\\c/d"}},
+    {R"({"weather":[{"id":800,"main":"\u00e9t\u00e9"}],"main":{"temp":1}})",
+     {"1", "800", "u00e9tu00e9"}},
+    // structure inside strings that are skipped
+    {R"({"name":"} ] , { \" [","weather":[{"description":"x\",\"main\":\"y",)"
+     R"("id":2,"main":"Rain"}],"main":{"temp":-0.5}})",
+     {"-0.5", "2", "Rain"}},
+    // escaped keys are compared after unescaping
+    {R"({"ma\in":{"temp":7},"weather":[{"id":3,"main":"Fog"}]})",
+     {"7", "3", "Fog"}},
+    // missing fields
+    {R"({"weather":[],"main":{"temp":12.5}})", {"12.5", NULL, NULL}},
+    {R"({"weather":[{"id":800}],"main":{}})", {NULL, "800", NULL}},
+    {R"({"main":{"feels_like":3,"temp_max":4}})", {NULL, NULL, NULL}},
+    {"{}", {NULL, NULL, NULL}},
+    {"", {NULL, NULL, NULL}},
+    // same names at other paths do not count
+    {R"({"sys":{"main":{"temp":5}},"weather":[{"id":1},{"id":2,"main":"X"}],)"
+     R"("main":{"temp":6}})",
+     {"6", "1", NULL}},
+    {R"({"weather":{"id":4,"main":"Obj"},"main":[{"temp":1}]})",
+     {NULL, NULL, NULL}},
+    // values of other types are kept as text, long ones are cut
+    {R"({"weather":[{"id":"801","main":null}],"main":{"temp":true}})",
+     {"true", "801", "null"}},
+    {R"({"weather":[{"id":1,"main":"abcdefghijklmnopqrstuvwxyz0123456789"}],)"
+     R"("main":{"temp":1}})",
+     {"1", "1", "abcdefghijklmnopqrstuvwxyz01234"}},
+    // containers are not values
+    {R"({"weather":[{"id":[1],"main":{"a":1}}],"main":{"temp":2}})",
+     {"2", NULL, NULL}},
+    // whitespace
+    {" {\n \"weather\" : [ { \"id\" : 5 , \"main\" : \"Sun\" } ] ,\r\n"
+     "\t\"main\" : { \"temp\" : 20 } } ",
+     {"20", "5", "Sun"}},
+    // malformed documents stop the parse
+    {R"({"main" {"temp":1}})", {NULL, NULL, NULL}},
+    {R"({"main":{"temp":1]})", {"1", NULL, NULL}},
+    {R"({"main":{"temp":1}}, "weather":[{"id":1,"main":"A"}])",
+     {"1", NULL, NULL}},
+    {R"([[[[[[[[[{"main":{"temp":1}}]]]]]]]]])", {NULL, NULL, NULL}},
+};
+
+static void checkCases() {
+  for (const jsonCase &c : cases) {
+    std::string body(c.json);
+    WatchyJSON response(weatherFields, 3);
+    ReplayStream stream(body);
+    bool all = c.values[0] && c.values[1] && c.values[2];
+    check(response.parse(stream) == all, c.json, "complete() is wrong");
+    for (uint8_t i = 0; i < 3; i++) {
+      if (c.values[i] == NULL) {
+        check(!response.found(i), c.json, weatherFields[i]);
+      } else {
+        check(response.found(i) && strcmp(response.value(i), c.values[i]) == 0,
+              c.json, response.value(i));
+      }
+    }
+  }
+}
+
+int main(int argc, char **argv) {
+  std::string dir = argc > 1 ? argv[1] : "payloads";
+  std::vector<std::string> names;
+  if (DIR *d = opendir(dir.c_str())) {
+    while (dirent *entry = readdir(d)) {
+      std::string name = entry->d_name;
+      if (name.size() > 5 && name.compare(name.size() - 5, 5, ".json") == 0) {
+        names.push_back(name);
+      }
+    }
+    closedir(d);
+  }
+  std::sort(names.begin(), names.end());
+  check(!names.empty(), "no responses in", dir.c_str());
+
+  for (const std::string &name : names) {
+    std::string body;
+    if (!readFile(dir + "/" + name, body)) {
+      check(false, "cannot read", name.c_str());
+      continue;
+    }
+    replay(name.c_str(), body);
+  }
+  checkCases();
+
+  if (failures) {
+    printf("%d WatchyJSON checks failed\n", failures);
+    return 1;
+  }
+  printf("WatchyJSON checks passed\n");
+  return 0;
+}
@@ -0,0 +1,10 @@
+// One of these is built per example face, with the face's sketch included
+// below so FACE names its watch object. setup() and loop() come along
+// unused, main() runs the benchmark in their place.
+#include <Arduino.h>
+#include SKETCH
+
+int main() {
+  FACE.benchmarkWatchFace();
+  return 0;
+}
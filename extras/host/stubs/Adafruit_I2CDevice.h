@@ -0,0 +1 @@
+// Adafruit GFX includes these for its SPI and I2C displays only
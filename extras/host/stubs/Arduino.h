@@ -0,0 +1,81 @@
+#ifndef HOST_ARDUINO_H
+#define HOST_ARDUINO_H
+
+// Host stand-in for the parts of the ESP32 Arduino core the library uses.
+// Time is the host's monotonic clock, pins read as released and the sleep
+// calls return at once.
+
+#include <ctype.h>
+#include <math.h>
+#include <stdarg.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <algorithm>
+#include <string>
+
+using std::max;
+using std::min;
+
+typedef uint8_t byte;
+typedef bool boolean;
+
+#define PROGMEM
+#define RTC_DATA_ATTR
+#define IRAM_ATTR
+#define pgm_read_byte(addr)    (*(const uint8_t *)(addr))
+#define pgm_read_word(addr)    (*(const uint16_t *)(addr))
+#define pgm_read_dword(addr)   (*(const uint32_t *)(addr))
+#define pgm_read_pointer(addr) (*(void *const *)(addr))
+#define constrain(amt, low, high)                                              \
+  ((amt) < (low) ? (low) : ((amt) > (high) ? (high) : (amt)))
+
+#define INPUT  0x01
+#define OUTPUT 0x03
+#define LOW    0x0
+#define HIGH   0x1
+#define SDA    21
+#define SCL    22
+#define DEC    10
+#define HEX    16
+
+#define GPIO_SEL_4  (1ULL << 4)
+#define GPIO_SEL_14 (1ULL << 14)
+#define GPIO_SEL_25 (1ULL << 25)
+#define GPIO_SEL_26 (1ULL << 26)
+#define GPIO_SEL_32 (1ULL << 32)
+#define GPIO_SEL_35 (1ULL << 35)
+
+unsigned long millis();
+unsigned long micros();
+void delay(uint32_t ms);
+void delayMicroseconds(uint32_t us);
+inline void pinMode(uint8_t, uint8_t) {}
+inline void digitalWrite(uint8_t, uint8_t) {}
+inline int digitalRead(uint8_t) { return LOW; } // buttons are active high
+inline uint32_t analogReadMilliVolts(uint8_t) { return 2000; } // 4.0 V
+inline uint32_t esp_random() { return (uint32_t)rand(); }
+
+#include "Print.h"
+#include "WString.h"
+#include "Stream.h"
+
+class HardwareSerial : public Stream {
+public:
+  void begin(unsigned long) {}
+  void flush() { fflush(stdout); }
+  int available() { return 0; } // nothing is typed in
+  int read() { return -1; }
+  size_t write(uint8_t c) { return putchar(c) == EOF ? 0 : 1; }
+  using Print::write;
+  operator bool() { return true; }
+};
+
+extern HardwareSerial Serial;
+
+#include "esp_sleep.h"
+
+#endif
@@ -0,0 +1,8 @@
+#ifndef HOST_ARDUINO_JSON_H
+#define HOST_ARDUINO_JSON_H
+
+// Watchy.h still includes Arduino_JSON for faces that parse their own
+// responses, the library itself streams through WatchyJSON
+#include <Arduino.h>
+
+#endif
@@ -0,0 +1,9 @@
+#ifndef HOST_BLEDEVICE_H
+#define HOST_BLEDEVICE_H
+
+// Only the types src/BLE.h names, the host build leaves out src/BLE.cpp
+class BLEServer;
+class BLEService;
+class BLECharacteristic;
+
+#endif
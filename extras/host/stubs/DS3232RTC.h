@@ -0,0 +1,79 @@
+#ifndef HOST_DS3232RTC_H
+#define HOST_DS3232RTC_H
+
+#include <Arduino.h>
+#include <TimeLib.h>
+
+// A DS3231 whose clock stands at the time last set, 2026-01-01 00:00:00
+// until then. Alarm registers are kept but never fire, the control and
+// status registers read back what the calls below left in them.
+class DS3232RTC {
+public:
+  enum ALARM_TYPES_t {
+    ALM1_EVERY_SECOND  = 0x0F,
+    ALM1_MATCH_SECONDS = 0x0E,
+    ALM1_MATCH_MINUTES = 0x0C,
+    ALM1_MATCH_HOURS   = 0x08,
+    ALM1_MATCH_DATE    = 0x00,
+    ALM1_MATCH_DAY     = 0x10,
+    ALM2_EVERY_MINUTE  = 0x8E,
+    ALM2_MATCH_MINUTES = 0x8C,
+    ALM2_MATCH_HOURS   = 0x88,
+    ALM2_MATCH_DATE    = 0x80,
+    ALM2_MATCH_DAY     = 0x90,
+  };
+  enum ALARM_NBR_t { ALARM_1, ALARM_2 };
+  enum SQWAVE_FREQS_t {
+    SQWAVE_1_HZ,
+    SQWAVE_1024_HZ,
+    SQWAVE_4096_HZ,
+    SQWAVE_8192_HZ,
+    SQWAVE_NONE,
+  };
+
+  explicit DS3232RTC(bool initI2C = true) {}
+  time_t get() { return _time; }
+  uint8_t set(time_t t) {
+    _time = t;
+    return 0;
+  }
+  uint8_t read(tmElements_t &tm) {
+    breakTime(_time, tm);
+    return 0;
+  }
+  uint8_t write(tmElements_t &tm) { return set(makeTime(tm)); }
+  void setAlarm(ALARM_TYPES_t type, uint8_t seconds, uint8_t minutes,
+                uint8_t hours, uint8_t daydate) {}
+  void alarmInterrupt(ALARM_NBR_t alarmNumber, bool alarmEnabled) {
+    uint8_t bit = 1 << alarmNumber;
+    _control    = alarmEnabled ? _control | bit : _control & ~bit;
+  }
+  bool alarm(ALARM_NBR_t alarmNumber) { // reads and clears the flag
+    uint8_t bit = 1 << alarmNumber;
+    bool fired  = _status & bit;
+    _status     &= ~bit;
+    return fired;
+  }
+  void squareWave(SQWAVE_FREQS_t freq) {
+    _control = freq == SQWAVE_NONE ? _control | 0x04 : _control & ~0x04;
+  }
+  int16_t temperature() { return 25 * 4; } // quarter degrees
+  uint8_t readRTC(uint8_t addr) {
+    return addr == 0x0E ? _control : addr == 0x0F ? _status : 0;
+  }
+  uint8_t writeRTC(uint8_t addr, uint8_t value) {
+    if (addr == 0x0E) {
+      _control = value;
+    } else if (addr == 0x0F) {
+      _status = value;
+    }
+    return 0;
+  }
+
+private:
+  time_t _time     = 1767225600; // 2026-01-01 00:00:00
+  uint8_t _control = 0x1C;       // power-on value, INTCN set
+  uint8_t _status  = 0;
+};
+
+#endif
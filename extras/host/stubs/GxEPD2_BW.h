@@ -0,0 +1,53 @@
+#ifndef HOST_GXEPD2_BW_H
+#define HOST_GXEPD2_BW_H
+
+#include <Adafruit_GFX.h>
+
+#define GxEPD_BLACK 0x0000
+#define GxEPD_WHITE 0xFFFF
+
+#ifndef _swap_int16_t
+#define _swap_int16_t(a, b)                                                    \
+  {                                                                            \
+    int16_t t = a;                                                             \
+    a         = b;                                                             \
+    b         = t;                                                             \
+  }
+#endif
+
+// The panel driver WatchyDisplay writes to. There is no panel, so
+// transfers and refreshes are dropped.
+class GxEPD2_154_D67 {
+public:
+  static const uint16_t WIDTH            = 200;
+  static const uint16_t HEIGHT           = 200;
+  static const bool hasFastPartialUpdate = true;
+
+  GxEPD2_154_D67(int16_t cs, int16_t dc, int16_t rst, int16_t busy) {}
+  void init(uint32_t serial_diag_bitrate = 0) {}
+  void init(uint32_t serial_diag_bitrate, bool initial,
+            uint16_t reset_duration = 10, bool pulldown_rst_mode = false) {}
+  void setBusyCallback(void (*busyCallback)(const void *),
+                       const void *busy_callback_parameter = 0) {}
+  void writeImage(const uint8_t bitmap[], int16_t x, int16_t y, int16_t w,
+                  int16_t h, bool invert = false, bool mirror_y = false,
+                  bool pgm = false) {}
+  void writeImageAgain(const uint8_t bitmap[], int16_t x, int16_t y,
+                       int16_t w, int16_t h, bool invert = false,
+                       bool mirror_y = false, bool pgm = false) {}
+  void writeImagePart(const uint8_t bitmap[], int16_t x_part, int16_t y_part,
+                      int16_t w_bitmap, int16_t h_bitmap, int16_t x,
+                      int16_t y, int16_t w, int16_t h, bool invert = false,
+                      bool mirror_y = false, bool pgm = false) {}
+  void writeImagePartAgain(const uint8_t bitmap[], int16_t x_part,
+                           int16_t y_part, int16_t w_bitmap, int16_t h_bitmap,
+                           int16_t x, int16_t y, int16_t w, int16_t h,
+                           bool invert = false, bool mirror_y = false,
+                           bool pgm = false) {}
+  void refresh(bool partial_update_mode = false) {}
+  void refresh(int16_t x, int16_t y, int16_t w, int16_t h) {}
+  void powerOff() {}
+  void hibernate() {}
+};
+
+#endif
@@ -0,0 +1,30 @@
+#ifndef HOST_HTTPCLIENT_H
+#define HOST_HTTPCLIENT_H
+
+#include <WiFi.h>
+
+#define HTTPC_ERROR_CONNECTION_REFUSED (-1)
+#define HTTP_CODE_OK                   200
+#define HTTP_CODE_NOT_MODIFIED         304
+
+class HTTPClient {
+public:
+  bool begin(String url) { return true; }
+  void end() {}
+  void useHTTP10(bool usehttp10 = true) {}
+  void setConnectTimeout(int32_t connectTimeout) {}
+  void setTimeout(uint16_t timeout) {}
+  void addHeader(const String &name, const String &value, bool first = false,
+                 bool replace = true) {}
+  void collectHeaders(const char *headerKeys[], const size_t headerKeysCount) {
+  }
+  int GET() { return HTTPC_ERROR_CONNECTION_REFUSED; }
+  String header(const char *name) { return String(); }
+  bool hasHeader(const char *name) { return false; }
+  WiFiClient &getStream() { return _client; }
+
+private:
+  WiFiClient _client;
+};
+
+#endif
@@ -0,0 +1,14 @@
+#ifndef HOST_NTPCLIENT_H
+#define HOST_NTPCLIENT_H
+
+#include <WiFiUdp.h>
+
+class NTPClient {
+public:
+  NTPClient(WiFiUDP &udp, const char *poolServerName, long timeOffset = 0) {}
+  void begin() {}
+  bool forceUpdate() { return false; }
+  unsigned long getEpochTime() const { return 0; }
+};
+
+#endif
@@ -0,0 +1,73 @@
+#ifndef HOST_PREFERENCES_H
+#define HOST_PREFERENCES_H
+
+#include <Arduino.h>
+#include <map>
+#include <vector>
+
+// NVS in memory, for one run. Same rules as the ESP32 Preferences: writes
+// fail on a read-only handle, and getBytes() fails if the buffer is short.
+class Preferences {
+public:
+  bool begin(const char *name, bool readOnly = false) {
+    _keys     = &_store()[name];
+    _readOnly = readOnly;
+    return true;
+  }
+  void end() { _keys = NULL; }
+  bool clear() {
+    if (!_writable()) {
+      return false;
+    }
+    _keys->clear();
+    return true;
+  }
+  bool remove(const char *key) { return _writable() && _keys->erase(key); }
+  bool isKey(const char *key) { return _keys && _keys->count(key); }
+
+  size_t putBytes(const char *key, const void *value, size_t len) {
+    if (!_writable() || value == NULL || len == 0) {
+      return 0;
+    }
+    const uint8_t *bytes = (const uint8_t *)value;
+    (*_keys)[key].assign(bytes, bytes + len);
+    return len;
+  }
+  size_t getBytesLength(const char *key) {
+    return isKey(key) ? (*_keys)[key].size() : 0;
+  }
+  size_t getBytes(const char *key, void *buf, size_t maxLen) {
+    size_t len = getBytesLength(key);
+    if (len == 0 || buf == NULL || len > maxLen) {
+      return 0;
+    }
+    memcpy(buf, (*_keys)[key].data(), len);
+    return len;
+  }
+  size_t putUChar(const char *key, uint8_t value) {
+    return putBytes(key, &value, sizeof(value));
+  }
+  uint8_t getUChar(const char *key, uint8_t defaultValue = 0) {
+    getBytes(key, &defaultValue, sizeof(defaultValue));
+    return defaultValue;
+  }
+  size_t putUInt(const char *key, uint32_t value) {
+    return putBytes(key, &value, sizeof(value));
+  }
+  uint32_t getUInt(const char *key, uint32_t defaultValue = 0) {
+    getBytes(key, &defaultValue, sizeof(defaultValue));
+    return defaultValue;
+  }
+
+private:
+  typedef std::map<std::string, std::vector<uint8_t>> namespaceKeys;
+  namespaceKeys *_keys = NULL;
+  bool _readOnly       = true;
+  bool _writable() { return _keys != NULL && !_readOnly; }
+  static std::map<std::string, namespaceKeys> &_store() {
+    static std::map<std::string, namespaceKeys> store;
+    return store;
+  }
+};
+
+#endif
@@ -0,0 +1,133 @@
+#ifndef HOST_PRINT_H
+#define HOST_PRINT_H
+
+#include "Printable.h"
+
+class String;
+
+// Same number formatting as the ESP32 core's Print, so text drawn through
+// Adafruit GFX lands on the same pixels as on the watch.
+class Print {
+public:
+  virtual ~Print() {}
+  virtual size_t write(uint8_t c) = 0;
+  virtual size_t write(const uint8_t *buffer, size_t size) {
+    size_t n = 0;
+    while (size--) {
+      n += write(*buffer++);
+    }
+    return n;
+  }
+  size_t write(const char *str) {
+    return str == NULL ? 0 : write((const uint8_t *)str, strlen(str));
+  }
+  size_t write(const char *buffer, size_t size) {
+    return write((const uint8_t *)buffer, size);
+  }
+
+  size_t printf(const char *format, ...) {
+    char buffer[256];
+    va_list args;
+    va_start(args, format);
+    int len = vsnprintf(buffer, sizeof(buffer), format, args);
+    va_end(args);
+    if (len < 0) {
+      return 0;
+    }
+    if ((size_t)len < sizeof(buffer)) {
+      return write(buffer, len);
+    }
+    std::string text(len + 1, '\0');
+    va_start(args, format);
+    vsnprintf(&text[0], text.size(), format, args);
+    va_end(args);
+    return write(text.c_str(), len);
+  }
+
+  size_t print(const String &s);
+  size_t print(const Printable &x) { return x.printTo(*this); }
+  size_t print(const char str[]) { return write(str); }
+  size_t print(char c) { return write(c); }
+  size_t print(unsigned char b, int base = DEC) {
+    return print((unsigned long)b, base);
+  }
+  size_t print(int n, int base = DEC) { return print((long)n, base); }
+  size_t print(unsigned int n, int base = DEC) {
+    return print((unsigned long)n, base);
+  }
+  size_t print(long n, int base = DEC) {
+    if (base == DEC && n < 0) {
+      return print('-') + _printNumber(-(unsigned long)n, base);
+    }
+    return _printNumber(n, base);
+  }
+  size_t print(unsigned long n, int base = DEC) {
+    return _printNumber(n, base);
+  }
+  size_t print(double number, int digits = 2) {
+    return _printFloat(number, digits);
+  }
+
+  template <typename T> size_t println(T value) {
+    size_t n = print(value);
+    return n + println();
+  }
+  template <typename T> size_t println(T value, int format) {
+    size_t n = print(value, format);
+    return n + println();
+  }
+  size_t println() { return print("\r\n"); }
+
+private:
+  size_t _printNumber(unsigned long n, uint8_t base) {
+    char buffer[8 * sizeof(long) + 1];
+    char *str = &buffer[sizeof(buffer) - 1];
+    *str      = '\0';
+    if (base < 2) {
+      base = 10;
+    }
+    do {
+      char c = n % base;
+      n      /= base;
+      *--str = c < 10 ? c + '0' : c + 'A' - 10;
+    } while (n);
+    return write(str);
+  }
+
+  size_t _printFloat(double number, uint8_t digits) {
+    if (isnan(number)) {
+      return print("nan");
+    }
+    if (isinf(number)) {
+      return print("inf");
+    }
+    if (number > 4294967040.0 || number < -4294967040.0) {
+      return print("ovf");
+    }
+    size_t n = 0;
+    if (number < 0.0) {
+      n      += print('-');
+      number = -number;
+    }
+    double rounding = 0.5;
+    for (uint8_t i = 0; i < digits; ++i) {
+      rounding /= 10.0;
+    }
+    number                 += rounding;
+    unsigned long intPart  = (unsigned long)number;
+    double remainder       = number - (double)intPart;
+    n                      += print(intPart);
+    if (digits > 0) {
+      n += print(".");
+    }
+    while (digits-- > 0) {
+      remainder   *= 10.0;
+      int toPrint = int(remainder);
+      n           += print(toPrint);
+      remainder   -= toPrint;
+    }
+    return n;
+  }
+};
+
+#endif
@@ -0,0 +1,13 @@
+#ifndef HOST_RTC_PCF8563_H
+#define HOST_RTC_PCF8563_H
+
+#include <Arduino.h>
+
+// Never selected on the host, the stand-in bus has no PCF8563 on it
+class Rtc_Pcf8563 {
+public:
+  void setDate(byte day, byte weekday, byte month, bool century, byte year) {}
+  void setTime(byte hour, byte minute, byte sec) {}
+};
+
+#endif
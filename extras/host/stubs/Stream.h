@@ -0,0 +1,26 @@
+#ifndef HOST_STREAM_H
+#define HOST_STREAM_H
+
+class Stream : public Print {
+public:
+  virtual int available() = 0;
+  virtual int read()      = 0;
+  virtual int peek() { return -1; }
+  void setTimeout(unsigned long timeout) { _timeout = timeout; }
+  // a host stream has all of its bytes at hand, so there is no waiting
+  size_t readBytes(uint8_t *buffer, size_t length) {
+    size_t n = 0;
+    for (int c; n < length && (c = read()) >= 0; n++) {
+      buffer[n] = c;
+    }
+    return n;
+  }
+  size_t readBytes(char *buffer, size_t length) {
+    return readBytes((uint8_t *)buffer, length);
+  }
+
+protected:
+  unsigned long _timeout = 1000;
+};
+
+#endif
@@ -0,0 +1,41 @@
+#ifndef HOST_TIMELIB_H
+#define HOST_TIMELIB_H
+
+#include <Arduino.h>
+
+typedef struct {
+  uint8_t Second;
+  uint8_t Minute;
+  uint8_t Hour;
+  uint8_t Wday; // day of week, Sunday is 1
+  uint8_t Day;
+  uint8_t Month;
+  uint8_t Year; // offset from 1970
+} tmElements_t;
+
+#define SECS_PER_MIN  ((time_t)(60UL))
+#define SECS_PER_HOUR ((time_t)(3600UL))
+#define SECS_PER_DAY  ((time_t)(SECS_PER_HOUR * 24UL))
+
+#define tmYearToCalendar(Y) ((Y) + 1970)
+#define CalendarYrToTm(Y)   ((Y) - 1970)
+#define tmYearToY2k(Y)      ((Y) - 30)
+#define y2kYearToTm(Y)      ((Y) + 30)
+
+time_t makeTime(const tmElements_t &tm);
+void breakTime(time_t time, tmElements_t &tm);
+
+int second(time_t t);
+int minute(time_t t);
+int hour(time_t t);
+int day(time_t t);
+int weekday(time_t t);
+int month(time_t t);
+int year(time_t t);
+
+const char *dayStr(uint8_t day);
+const char *dayShortStr(uint8_t day);
+const char *monthStr(uint8_t month);
+const char *monthShortStr(uint8_t month);
+
+#endif
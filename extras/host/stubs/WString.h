@@ -0,0 +1,84 @@
+#ifndef HOST_WSTRING_H
+#define HOST_WSTRING_H
+
+class __FlashStringHelper;
+#define F(literal) (reinterpret_cast<const __FlashStringHelper *>(literal))
+
+// Arduino String over std::string, for the calls the library and the
+// example faces make
+class String {
+public:
+  String(const char *str = "") : _s(str != NULL ? str : "") {}
+  String(const std::string &str) : _s(str) {}
+  explicit String(char c) : _s(1, c) {}
+  explicit String(int value) : _s(std::to_string(value)) {}
+  explicit String(unsigned int value) : _s(std::to_string(value)) {}
+  explicit String(long value) : _s(std::to_string(value)) {}
+  explicit String(unsigned long value) : _s(std::to_string(value)) {}
+
+  const char *c_str() const { return _s.c_str(); }
+  unsigned int length() const { return _s.length(); }
+  bool isEmpty() const { return _s.empty(); }
+  bool reserve(unsigned int size) {
+    _s.reserve(size);
+    return true;
+  }
+  char charAt(unsigned int index) const {
+    return index < _s.length() ? _s[index] : '\0';
+  }
+  char operator[](unsigned int index) const { return charAt(index); }
+  int indexOf(char c, unsigned int from = 0) const {
+    size_t i = _s.find(c, from);
+    return i == std::string::npos ? -1 : (int)i;
+  }
+  String substring(unsigned int from) const {
+    return from < _s.length() ? String(_s.substr(from)) : String();
+  }
+  String substring(unsigned int from, unsigned int to) const {
+    if (from > to) {
+      std::swap(from, to);
+    }
+    return from < _s.length() ? String(_s.substr(from, to - from))
+                              : String();
+  }
+  long toInt() const { return atol(_s.c_str()); }
+  float toFloat() const { return atof(_s.c_str()); }
+
+  bool equals(const String &s) const { return _s == s._s; }
+  bool operator==(const String &s) const { return _s == s._s; }
+  bool operator==(const char *s) const { return _s == s; }
+  bool operator!=(const String &s) const { return _s != s._s; }
+  bool operator!=(const char *s) const { return _s != s; }
+  String &operator+=(const String &s) {
+    _s += s._s;
+    return *this;
+  }
+  String &operator+=(const char *s) {
+    _s += s;
+    return *this;
+  }
+  String &operator+=(char c) {
+    _s += c;
+    return *this;
+  }
+  String &operator+=(int value) {
+    _s += std::to_string(value);
+    return *this;
+  }
+  friend String operator+(const String &a, const String &b) {
+    return String(a._s + b._s);
+  }
+  friend String operator+(const String &a, const char *b) {
+    return String(a._s + b);
+  }
+  friend String operator+(const char *a, const String &b) {
+    return String(a + b._s);
+  }
+
+private:
+  std::string _s;
+};
+
+inline size_t Print::print(const String &s) { return write(s.c_str()); }
+
+#endif
@@ -0,0 +1,86 @@
+#ifndef HOST_WIFI_H
+#define HOST_WIFI_H
+
+#include <Arduino.h>
+
+// The host is offline: no credentials are stored and every connect fails,
+// so the library takes its fallback paths.
+
+class IPAddress : public Printable {
+public:
+  IPAddress(uint32_t address = 0) : _address(address) {}
+  IPAddress(uint8_t a, uint8_t b, uint8_t c, uint8_t d)
+      : _address(a | b << 8 | c << 16 | (uint32_t)d << 24) {}
+  operator uint32_t() const { return _address; }
+  size_t printTo(Print &p) const {
+    return p.printf("%u.%u.%u.%u", _address & 0xFF, _address >> 8 & 0xFF,
+                    _address >> 16 & 0xFF, _address >> 24);
+  }
+
+private:
+  uint32_t _address;
+};
+
+const IPAddress INADDR_NONE(0, 0, 0, 0);
+
+typedef enum {
+  WL_IDLE_STATUS     = 0,
+  WL_NO_SSID_AVAIL   = 1,
+  WL_SCAN_COMPLETED  = 2,
+  WL_CONNECTED       = 3,
+  WL_CONNECT_FAILED  = 4,
+  WL_CONNECTION_LOST = 5,
+  WL_DISCONNECTED    = 6,
+} wl_status_t;
+
+typedef enum {
+  WIFI_OFF    = 0,
+  WIFI_STA    = 1,
+  WIFI_AP     = 2,
+  WIFI_AP_STA = 3,
+} wifi_mode_t;
+
+class WiFiClass {
+public:
+  bool mode(wifi_mode_t mode) { return true; }
+  wl_status_t begin() { return WL_CONNECT_FAILED; }
+  wl_status_t begin(const char *ssid, const char *passphrase = NULL,
+                    int32_t channel = 0, const uint8_t *bssid = NULL,
+                    bool connect = true) {
+    return WL_DISCONNECTED;
+  }
+  bool config(IPAddress local_ip, IPAddress gateway, IPAddress subnet,
+              IPAddress dns1 = (uint32_t)0, IPAddress dns2 = (uint32_t)0) {
+    return true;
+  }
+  uint8_t waitForConnectResult(unsigned long timeoutLength = 60000) {
+    return WL_DISCONNECTED;
+  }
+  wl_status_t status() { return WL_DISCONNECTED; }
+  bool disconnect(bool wifioff = false, bool eraseap = false) { return true; }
+  String SSID() { return String(); }
+  uint8_t *BSSID() {
+    static uint8_t bssid[6];
+    return bssid;
+  }
+  int32_t channel() { return 0; }
+  IPAddress localIP() { return IPAddress(); }
+  IPAddress gatewayIP() { return IPAddress(); }
+  IPAddress subnetMask() { return IPAddress(); }
+  IPAddress dnsIP(uint8_t dns_no = 0) { return IPAddress(); }
+  IPAddress softAPIP() { return IPAddress(); }
+};
+
+extern WiFiClass WiFi;
+
+class WiFiClient : public Stream {
+public:
+  int available() { return 0; }
+  int read() { return -1; }
+  size_t write(uint8_t) { return 0; }
+  using Print::write;
+  uint8_t connected() { return 0; }
+  void stop() {}
+};
+
+#endif
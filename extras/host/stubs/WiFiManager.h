@@ -0,0 +1,16 @@
+#ifndef HOST_WIFIMANAGER_H
+#define HOST_WIFIMANAGER_H
+
+#include <WiFi.h>
+
+class WiFiManager {
+public:
+  void resetSettings() {}
+  void setTimeout(unsigned long seconds) {}
+  void setAPCallback(void (*func)(WiFiManager *)) {}
+  bool autoConnect(const char *apName, const char *apPassword = NULL) {
+    return false; // nobody joins the portal
+  }
+};
+
+#endif
@@ -0,0 +1,8 @@
+#ifndef HOST_WIFIUDP_H
+#define HOST_WIFIUDP_H
+
+#include <WiFi.h>
+
+class WiFiUDP {};
+
+#endif
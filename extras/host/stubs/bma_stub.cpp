@@ -0,0 +1,142 @@
+#include "bma.h"
+
+// Stands in for src/bma.cpp: a BMA423 lying face up on a desk, no steps,
+// no interrupts and an empty FIFO. Nothing goes over I2C.
+
+static uint32_t steps;
+
+BMA423::BMA423() { __init = false; }
+
+BMA423::~BMA423() {}
+
+bool BMA423::begin(bma4_com_fptr_t readCallBlack,
+                   bma4_com_fptr_t writeCallBlack,
+                   bma4_delay_fptr_t delayCallBlack, uint8_t address) {
+  __init = true;
+  return true;
+}
+
+bool BMA423::restore(bma4_com_fptr_t readCallBlack,
+                     bma4_com_fptr_t writeCallBlack,
+                     bma4_delay_fptr_t delayCallBlack) {
+  return __init;
+}
+
+bool BMA423::configResident() { return __init; }
+
+void BMA423::softReset() { steps = 0; }
+
+void BMA423::shutDown() {}
+
+void BMA423::wakeUp() {}
+
+bool BMA423::selfTest() { return true; }
+
+uint8_t BMA423::getDirection() { return DIRECTION_DISP_UP; }
+
+bool BMA423::setAccelConfig(Acfg &cfg) { return true; }
+
+bool BMA423::getAccelConfig(Acfg &cfg) { return true; }
+
+bool BMA423::getAccel(Accel &acc) {
+  acc.x = 0;
+  acc.y = 0;
+  acc.z = 512; // 1 g at the default 4 g range
+  return true;
+}
+
+bool BMA423::getAccelEnable() { return true; }
+
+bool BMA423::disableAccel() { return true; }
+
+bool BMA423::enableAccel(bool en) { return true; }
+
+bool BMA423::setINTPinConfig(struct bma4_int_pin_config config,
+                             uint8_t pinMap) {
+  return true;
+}
+
+bool BMA423::setINTMode(uint8_t mode) { return true; }
+
+bool BMA423::getINT() {
+  __IRQ_MASK = 0;
+  return true;
+}
+
+uint8_t BMA423::getIRQMASK() { return __IRQ_MASK; }
+
+bool BMA423::disableIRQ(uint16_t int_map) { return true; }
+
+bool BMA423::enableIRQ(uint16_t int_map) { return true; }
+
+bool BMA423::isStepCounter() { return false; }
+
+bool BMA423::isDoubleClick() { return false; }
+
+bool BMA423::isTilt() { return false; }
+
+bool BMA423::isActivity() { return false; }
+
+bool BMA423::isAnyNoMotion() { return false; }
+
+bool BMA423::resetStepCounter() {
+  steps = 0;
+  return true;
+}
+
+uint32_t BMA423::getCounter() { return steps; }
+
+float BMA423::readTemperature() { return 25; }
+
+float BMA423::readTemperatureF() { return 77; }
+
+uint16_t BMA423::getErrorCode() { return 0; }
+
+uint16_t BMA423::getStatus() { return 0; }
+
+uint32_t BMA423::getSensorTime() { return 0; }
+
+const char *BMA423::getActivity() { return "None"; }
+
+uint8_t BMA423::getActivityState() { return BMA423_USER_STATIONARY; }
+
+bool BMA423::setRemapAxes(struct bma423_axes_remap *remap_data) {
+  return true;
+}
+
+bool BMA423::setAnyMotionConfig(struct bma423_anymotion_config &config) {
+  return true;
+}
+
+bool BMA423::enableAnyMotionAxis(uint8_t axis) { return true; }
+
+bool BMA423::enableFIFO(uint8_t odr, uint16_t frames) {
+  __fifoFrames = frames;
+  return true;
+}
+
+bool BMA423::disableFIFO() {
+  __fifoFrames = 0;
+  return true;
+}
+
+bool BMA423::isFIFOEnabled() { return __fifoFrames != 0; }
+
+bool BMA423::isFIFOWatermark() { return false; }
+
+uint16_t BMA423::readFIFO(uint8_t *buffer, uint16_t size, Accel *samples,
+                          uint16_t count) {
+  return 0;
+}
+
+bool BMA423::enableFeature(uint8_t feature, uint8_t enable) { return true; }
+
+bool BMA423::enableStepCountInterrupt(bool en) { return true; }
+
+bool BMA423::enableTiltInterrupt(bool en) { return true; }
+
+bool BMA423::enableWakeupInterrupt(bool en) { return true; }
+
+bool BMA423::enableAnyNoMotionInterrupt(bool en) { return true; }
+
+bool BMA423::enableActivityInterrupt(bool en) { return true; }
@@ -0,0 +1,6 @@
+#ifndef HOST_ESP_OTA_OPS_H
+#define HOST_ESP_OTA_OPS_H
+
+#include <Arduino.h>
+
+#endif
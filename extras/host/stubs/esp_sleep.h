@@ -0,0 +1,59 @@
+#ifndef HOST_ESP_SLEEP_H
+#define HOST_ESP_SLEEP_H
+
+// Every run is a reset. Light sleep returns at once, deep sleep ends the
+// process, since on the watch it never returns either.
+
+typedef int esp_err_t;
+#define ESP_OK   0
+#define ESP_FAIL -1
+
+typedef enum {
+  ESP_SLEEP_WAKEUP_UNDEFINED,
+  ESP_SLEEP_WAKEUP_ALL,
+  ESP_SLEEP_WAKEUP_EXT0,
+  ESP_SLEEP_WAKEUP_EXT1,
+  ESP_SLEEP_WAKEUP_TIMER,
+  ESP_SLEEP_WAKEUP_TOUCHPAD,
+  ESP_SLEEP_WAKEUP_ULP,
+  ESP_SLEEP_WAKEUP_GPIO,
+} esp_sleep_wakeup_cause_t;
+typedef esp_sleep_wakeup_cause_t esp_sleep_source_t;
+
+typedef enum {
+  ESP_EXT1_WAKEUP_ALL_LOW  = 0,
+  ESP_EXT1_WAKEUP_ANY_HIGH = 1,
+} esp_sleep_ext1_wakeup_mode_t;
+
+typedef int gpio_num_t;
+typedef enum {
+  GPIO_INTR_LOW_LEVEL  = 4,
+  GPIO_INTR_HIGH_LEVEL = 5,
+} gpio_int_type_t;
+
+inline esp_sleep_wakeup_cause_t esp_sleep_get_wakeup_cause() {
+  return ESP_SLEEP_WAKEUP_UNDEFINED;
+}
+inline uint64_t esp_sleep_get_ext1_wakeup_status() { return 0; }
+inline esp_err_t esp_sleep_enable_ext0_wakeup(gpio_num_t, int) {
+  return ESP_OK;
+}
+inline esp_err_t esp_sleep_enable_ext1_wakeup(uint64_t,
+                                              esp_sleep_ext1_wakeup_mode_t) {
+  return ESP_OK;
+}
+inline esp_err_t esp_sleep_enable_timer_wakeup(uint64_t) { return ESP_OK; }
+inline esp_err_t esp_sleep_enable_gpio_wakeup() { return ESP_OK; }
+inline esp_err_t esp_sleep_disable_wakeup_source(esp_sleep_source_t) {
+  return ESP_OK;
+}
+inline esp_err_t gpio_wakeup_enable(gpio_num_t, gpio_int_type_t) {
+  return ESP_OK;
+}
+inline esp_err_t gpio_wakeup_disable(gpio_num_t) { return ESP_OK; }
+inline esp_err_t esp_light_sleep_start() { return ESP_OK; }
+inline void esp_deep_sleep_start() { exit(0); }
+inline void esp_restart() { exit(0); }
+inline void btStop() {}
+
+#endif
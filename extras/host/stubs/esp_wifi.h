@@ -0,0 +1,26 @@
+#ifndef HOST_ESP_WIFI_H
+#define HOST_ESP_WIFI_H
+
+#include <WiFi.h>
+
+typedef enum {
+  WIFI_IF_STA = 0,
+  WIFI_IF_AP  = 1,
+} wifi_interface_t;
+
+typedef struct {
+  uint8_t ssid[32];
+  uint8_t password[64];
+} wifi_sta_config_t;
+
+typedef union {
+  wifi_sta_config_t sta;
+} wifi_config_t;
+
+inline esp_err_t esp_wifi_get_config(wifi_interface_t interface,
+                                     wifi_config_t *conf) {
+  memset(conf, 0, sizeof(*conf)); // nothing stored
+  return ESP_OK;
+}
+
+#endif
@@ -0,0 +1,139 @@
+#include <Arduino.h>
+#include <TimeLib.h>
+#include <WiFi.h>
+#include <Wire.h>
+#include <chrono>
+#include <thread>
+#include "BLE.h"
+
+HardwareSerial Serial;
+TwoWire Wire;
+WiFiClass WiFi;
+
+static const std::chrono::steady_clock::time_point started =
+    std::chrono::steady_clock::now();
+
+unsigned long millis() { return micros() / 1000; }
+
+unsigned long micros() {
+  return std::chrono::duration_cast<std::chrono::microseconds>(
+             std::chrono::steady_clock::now() - started)
+      .count();
+}
+
+void delay(uint32_t ms) {
+  std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+}
+
+void delayMicroseconds(uint32_t us) {
+  std::this_thread::sleep_for(std::chrono::microseconds(us));
+}
+
+// TimeLib, same calendar math
+
+#define LEAP_YEAR(Y)                                                           \
+  (((1970 + (Y)) > 0) && !((1970 + (Y)) % 4) &&                              \
+   (((1970 + (Y)) % 100) || !((1970 + (Y)) % 400)))
+
+static const uint8_t monthDays[] = {31, 28, 31, 30, 31, 30,
+                                    31, 31, 30, 31, 30, 31};
+
+void breakTime(time_t timeInput, tmElements_t &tm) {
+  uint32_t time = (uint32_t)timeInput;
+  tm.Second     = time % 60;
+  time          /= 60;
+  tm.Minute     = time % 60;
+  time          /= 60;
+  tm.Hour       = time % 24;
+  time          /= 24; // days
+  tm.Wday       = ((time + 4) % 7) + 1; // 1970-01-01 was a Thursday
+
+  uint8_t year  = 0;
+  uint32_t days = 0;
+  while ((days += (LEAP_YEAR(year) ? 366 : 365)) <= time) {
+    year++;
+  }
+  tm.Year = year;
+  days    -= LEAP_YEAR(year) ? 366 : 365;
+  time    -= days; // days in this year, from 0
+
+  uint8_t month;
+  for (month = 0; month < 12; month++) {
+    uint8_t length = month == 1 && LEAP_YEAR(year) ? 29 : monthDays[month];
+    if (time < length) {
+      break;
+    }
+    time -= length;
+  }
+  tm.Month = month + 1;
+  tm.Day   = time + 1;
+}
+
+time_t makeTime(const tmElements_t &tm) {
+  uint32_t seconds = tm.Year * (SECS_PER_DAY * 365);
+  for (int i = 0; i < tm.Year; i++) {
+    if (LEAP_YEAR(i)) {
+      seconds += SECS_PER_DAY;
+    }
+  }
+  for (int i = 1; i < tm.Month; i++) {
+    seconds += SECS_PER_DAY *
+               (i == 2 && LEAP_YEAR(tm.Year) ? 29 : monthDays[i - 1]);
+  }
+  seconds += (tm.Day - 1) * SECS_PER_DAY;
+  seconds += tm.Hour * SECS_PER_HOUR;
+  seconds += tm.Minute * SECS_PER_MIN;
+  seconds += tm.Second;
+  return (time_t)seconds;
+}
+
+static tmElements_t broken(time_t t) {
+  tmElements_t tm;
+  breakTime(t, tm);
+  return tm;
+}
+
+int second(time_t t) { return broken(t).Second; }
+int minute(time_t t) { return broken(t).Minute; }
+int hour(time_t t) { return broken(t).Hour; }
+int day(time_t t) { return broken(t).Day; }
+int weekday(time_t t) { return broken(t).Wday; }
+int month(time_t t) { return broken(t).Month; }
+int year(time_t t) { return tmYearToCalendar(broken(t).Year); }
+
+static const char *const dayNames[] = {
+    "Err",       "Sunday",   "Monday", "Tuesday",
+    "Wednesday", "Thursday", "Friday", "Saturday"};
+static const char *const monthNames[] = {
+    "",     "January", "February",  "March",   "April",    "May",     "June",
+    "July", "August",  "September", "October", "November", "December"};
+
+const char *dayStr(uint8_t day) { return dayNames[day <= 7 ? day : 0]; }
+
+const char *monthStr(uint8_t month) {
+  return monthNames[month <= 12 ? month : 0];
+}
+
+const char *dayShortStr(uint8_t day) {
+  static char name[4];
+  snprintf(name, sizeof(name), "%s", dayStr(day));
+  return name;
+}
+
+const char *monthShortStr(uint8_t month) {
+  static char name[4];
+  snprintf(name, sizeof(name), "%s", monthStr(month));
+  return name;
+}
+
+// src/BLE.cpp needs the ESP32 BLE stack, the host has no radio
+
+BLE::BLE(void) {}
+
+BLE::~BLE(void) {}
+
+bool BLE::begin(const char *localName) { return false; }
+
+int BLE::updateStatus() { return -1; }
+
+int BLE::howManyBytes() { return 0; }
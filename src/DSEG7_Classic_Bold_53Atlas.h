@@ -0,0 +1,244 @@
+// Generated by extras/glyph_atlas.py from DSEG7_Classic_Bold_53.h, '-' to ':'.
+// Do not edit, rerun the script instead.
+const uint8_t DSEG7_Classic_Bold_53AtlasBitmaps[] PROGMEM = {
+    0x1F, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x7F, 0xFF, 0xFF, 0x00,
+    0xFF, 0xFF, 0xFF, 0x80, 0x7F, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFE, 0x00,
+    0x1F, 0xFF, 0xFC, 0x00, // '-'
+    0x00, 0x78, 0xFC, 0xFC, 0xFC, 0xFC, 0x78, // '.'
+    0xFF, 0xFC, 0xFF, 0xFC, 0xC0, 0x0C, 0xC0, 0x0C, 0xC0, 0x0C, 0xC0, 0x0C,
+    0xC0, 0x0C, 0xC0, 0x0C, 0xC0, 0x0C, 0xC0, 0x0C, 0xC0, 0x0C, 0xC0, 0x0C,
+    0xC0, 0x0C, 0xC0, 0x0C, 0xC0, 0x0C, 0xC0, 0x0C, 0xC0, 0x0C, 0xC0, 0x0C,
+    0xC0, 0x0C, 0xC0, 0x0C, 0xC0, 0x0C, 0xC0, 0x0C, 0xC0, 0x0C, 0xC0, 0x0C,
+    0xC0, 0x0C, 0xC0, 0x0C, 0xC0, 0x0C, 0xC0, 0x0C, 0xC0, 0x0C, 0xC0, 0x0C,
+    0xC0, 0x0C, 0xC0, 0x0C, 0xC0, 0x0C, 0xC0, 0x0C, 0xFF, 0xFC, 0xFF, 0xFC, // '/'
+    0x0F, 0xFF, 0xFF, 0xF8, 0x00, 0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0x1F, 0xFF,
+    0xFF, 0xFC, 0x00, 0x6F, 0xFF, 0xFF, 0xFB, 0x00, 0xF7, 0xFF, 0xFF, 0xF7,
+    0x80, 0xFB, 0xFF, 0xFF, 0xEF, 0x80, 0xFD, 0xFF, 0xFF, 0xDF, 0x80, 0xFE,
+    0x00, 0x00, 0x3F, 0x80, 0xFE, 0x00, 0x00, 0x3F, 0x80, 0xFE, 0x00, 0x00,
+    0x3F, 0x80, 0xFE, 0x00, 0x00, 0x3F, 0x80, 0xFE, 0x00, 0x00, 0x3F, 0x80,
+    0xFE, 0x00, 0x00, 0x3F, 0x80, 0xFE, 0x00, 0x00, 0x3F, 0x80, 0xFE, 0x00,
+    0x00, 0x3F, 0x80, 0xFE, 0x00, 0x00, 0x3F, 0x80, 0xFE, 0x00, 0x00, 0x3F,
+    0x80, 0xFE, 0x00, 0x00, 0x3F, 0x80, 0xFE, 0x00, 0x00, 0x3F, 0x80, 0xFE,
+    0x00, 0x00, 0x3F, 0x80, 0xFE, 0x00, 0x00, 0x3F, 0x80, 0xFE, 0x00, 0x00,
+    0x3F, 0x80, 0xFE, 0x00, 0x00, 0x3F, 0x80, 0xFC, 0x00, 0x00, 0x1F, 0x80,
+    0xF8, 0x00, 0x00, 0x0F, 0x80, 0xF0, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x07, 0x80, 0xF8, 0x00, 0x00, 0x0F,
+    0x80, 0xFC, 0x00, 0x00, 0x1F, 0x80, 0xFE, 0x00, 0x00, 0x3F, 0x80, 0xFE,
+    0x00, 0x00, 0x3F, 0x80, 0xFE, 0x00, 0x00, 0x3F, 0x80, 0xFE, 0x00, 0x00,
+    0x3F, 0x80, 0xFE, 0x00, 0x00, 0x3F, 0x80, 0xFE, 0x00, 0x00, 0x3F, 0x80,
+    0xFE, 0x00, 0x00, 0x3F, 0x80, 0xFE, 0x00, 0x00, 0x3F, 0x80, 0xFE, 0x00,
+    0x00, 0x3F, 0x80, 0xFE, 0x00, 0x00, 0x3F, 0x80, 0xFE, 0x00, 0x00, 0x3F,
+    0x80, 0xFE, 0x00, 0x00, 0x3F, 0x80, 0xFE, 0x00, 0x00, 0x3F, 0x80, 0xFE,
+    0x00, 0x00, 0x3F, 0x80, 0xFE, 0x00, 0x00, 0x3F, 0x80, 0xFE, 0x00, 0x00,
+    0x3F, 0x80, 0xFD, 0xFF, 0xFF, 0xDF, 0x80, 0xFB, 0xFF, 0xFF, 0xEF, 0x80,
+    0xF7, 0xFF, 0xFF, 0xF7, 0x80, 0x6F, 0xFF, 0xFF, 0xFB, 0x00, 0x1F, 0xFF,
+    0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0xF8,
+    0x00, // '0'
+    0x00, 0x0C, 0x1E, 0x3E, 0x7E, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE,
+    0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0x7E, 0x3E, 0x1E,
+    0x00, 0x1E, 0x3E, 0x7E, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE,
+    0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0x7E, 0x3E, 0x1E, 0x0C,
+    0x00, // '1'
+    0x0F, 0xFF, 0xFF, 0xF8, 0x00, 0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0x1F, 0xFF,
+    0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0xFB, 0x00, 0x07, 0xFF, 0xFF, 0xF7,
+    0x80, 0x03, 0xFF, 0xFF, 0xEF, 0x80, 0x01, 0xFF, 0xFF, 0xDF, 0x80, 0x00,
+    0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00,
+    0x3F, 0x80, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x3F, 0x80,
+    0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00,
+    0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x3F,
+    0x80, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00,
+    0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00,
+    0x3F, 0x80, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x01, 0xFF, 0xFF, 0xDF, 0x80,
+    0x03, 0xFF, 0xFF, 0xEF, 0x80, 0x07, 0xFF, 0xFF, 0xF7, 0x80, 0x0F, 0xFF,
+    0xFF, 0xF8, 0x00, 0xF7, 0xFF, 0xFF, 0xF0, 0x00, 0xFB, 0xFF, 0xFF, 0xE0,
+    0x00, 0xFD, 0xFF, 0xFF, 0xC0, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFE,
+    0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00,
+    0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00,
+    0xFE, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00,
+    0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00,
+    0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFE,
+    0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00,
+    0x00, 0x00, 0xFD, 0xFF, 0xFF, 0xC0, 0x00, 0xFB, 0xFF, 0xFF, 0xE0, 0x00,
+    0xF7, 0xFF, 0xFF, 0xF0, 0x00, 0x6F, 0xFF, 0xFF, 0xF8, 0x00, 0x1F, 0xFF,
+    0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0xF8,
+    0x00, // '2'
+    0x7F, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xE0,
+    0x7F, 0xFF, 0xFF, 0xD8, 0x3F, 0xFF, 0xFF, 0xBC, 0x1F, 0xFF, 0xFF, 0x7C,
+    0x0F, 0xFF, 0xFE, 0xFC, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x01, 0xFC,
+    0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x01, 0xFC,
+    0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x01, 0xFC,
+    0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x01, 0xFC,
+    0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x01, 0xFC,
+    0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x01, 0xFC, 0x0F, 0xFF, 0xFE, 0xFC,
+    0x1F, 0xFF, 0xFF, 0x7C, 0x3F, 0xFF, 0xFF, 0xBC, 0x7F, 0xFF, 0xFF, 0xC0,
+    0x3F, 0xFF, 0xFF, 0xBC, 0x1F, 0xFF, 0xFF, 0x7C, 0x0F, 0xFF, 0xFE, 0xFC,
+    0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x01, 0xFC,
+    0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x01, 0xFC,
+    0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x01, 0xFC,
+    0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x01, 0xFC,
+    0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x01, 0xFC,
+    0x00, 0x00, 0x01, 0xFC, 0x0F, 0xFF, 0xFE, 0xFC, 0x1F, 0xFF, 0xFF, 0x7C,
+    0x3F, 0xFF, 0xFF, 0xBC, 0x7F, 0xFF, 0xFF, 0xD8, 0xFF, 0xFF, 0xFF, 0xE0,
+    0xFF, 0xFF, 0xFF, 0xE0, 0x7F, 0xFF, 0xFF, 0xC0, // '3'
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x03, 0x00, 0xF0, 0x00,
+    0x00, 0x07, 0x80, 0xF8, 0x00, 0x00, 0x0F, 0x80, 0xFC, 0x00, 0x00, 0x1F,
+    0x80, 0xFE, 0x00, 0x00, 0x3F, 0x80, 0xFE, 0x00, 0x00, 0x3F, 0x80, 0xFE,
+    0x00, 0x00, 0x3F, 0x80, 0xFE, 0x00, 0x00, 0x3F, 0x80, 0xFE, 0x00, 0x00,
+    0x3F, 0x80, 0xFE, 0x00, 0x00, 0x3F, 0x80, 0xFE, 0x00, 0x00, 0x3F, 0x80,
+    0xFE, 0x00, 0x00, 0x3F, 0x80, 0xFE, 0x00, 0x00, 0x3F, 0x80, 0xFE, 0x00,
+    0x00, 0x3F, 0x80, 0xFE, 0x00, 0x00, 0x3F, 0x80, 0xFE, 0x00, 0x00, 0x3F,
+    0x80, 0xFE, 0x00, 0x00, 0x3F, 0x80, 0xFE, 0x00, 0x00, 0x3F, 0x80, 0xFE,
+    0x00, 0x00, 0x3F, 0x80, 0xFE, 0x00, 0x00, 0x3F, 0x80, 0xFD, 0xFF, 0xFF,
+    0xDF, 0x80, 0xFB, 0xFF, 0xFF, 0xEF, 0x80, 0xF7, 0xFF, 0xFF, 0xF7, 0x80,
+    0x0F, 0xFF, 0xFF, 0xF8, 0x00, 0x07, 0xFF, 0xFF, 0xF7, 0x80, 0x03, 0xFF,
+    0xFF, 0xEF, 0x80, 0x01, 0xFF, 0xFF, 0xDF, 0x80, 0x00, 0x00, 0x00, 0x3F,
+    0x80, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00,
+    0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00,
+    0x3F, 0x80, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x3F, 0x80,
+    0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00,
+    0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x3F,
+    0x80, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00,
+    0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00,
+    0x0F, 0x80, 0x00, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x00, 0x03, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, // '4'
+    0x0F, 0xFF, 0xFF, 0xF8, 0x00, 0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0x1F, 0xFF,
+    0xFF, 0xFC, 0x00, 0x6F, 0xFF, 0xFF, 0xF8, 0x00, 0xF7, 0xFF, 0xFF, 0xF0,
+    0x00, 0xFB, 0xFF, 0xFF, 0xE0, 0x00, 0xFD, 0xFF, 0xFF, 0xC0, 0x00, 0xFE,
+    0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00,
+    0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00,
+    0xFE, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00,
+    0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00,
+    0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFE,
+    0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00,
+    0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFD, 0xFF, 0xFF, 0xC0, 0x00,
+    0xFB, 0xFF, 0xFF, 0xE0, 0x00, 0xF7, 0xFF, 0xFF, 0xF0, 0x00, 0x0F, 0xFF,
+    0xFF, 0xF8, 0x00, 0x07, 0xFF, 0xFF, 0xF7, 0x80, 0x03, 0xFF, 0xFF, 0xEF,
+    0x80, 0x01, 0xFF, 0xFF, 0xDF, 0x80, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00,
+    0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00,
+    0x3F, 0x80, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x3F, 0x80,
+    0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00,
+    0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x3F,
+    0x80, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00,
+    0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00,
+    0x3F, 0x80, 0x01, 0xFF, 0xFF, 0xDF, 0x80, 0x03, 0xFF, 0xFF, 0xEF, 0x80,
+    0x07, 0xFF, 0xFF, 0xF7, 0x80, 0x0F, 0xFF, 0xFF, 0xFB, 0x00, 0x1F, 0xFF,
+    0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0xF8,
+    0x00, // '5'
+    0x0F, 0xFF, 0xFF, 0xF8, 0x00, 0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0x1F, 0xFF,
+    0xFF, 0xFC, 0x00, 0x6F, 0xFF, 0xFF, 0xF8, 0x00, 0xF7, 0xFF, 0xFF, 0xF0,
+    0x00, 0xFB, 0xFF, 0xFF, 0xE0, 0x00, 0xFD, 0xFF, 0xFF, 0xC0, 0x00, 0xFE,
+    0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00,
+    0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00,
+    0xFE, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00,
+    0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00,
+    0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFE,
+    0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00,
+    0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFD, 0xFF, 0xFF, 0xC0, 0x00,
+    0xFB, 0xFF, 0xFF, 0xE0, 0x00, 0xF7, 0xFF, 0xFF, 0xF0, 0x00, 0x0F, 0xFF,
+    0xFF, 0xF8, 0x00, 0xF7, 0xFF, 0xFF, 0xF7, 0x80, 0xFB, 0xFF, 0xFF, 0xEF,
+    0x80, 0xFD, 0xFF, 0xFF, 0xDF, 0x80, 0xFE, 0x00, 0x00, 0x3F, 0x80, 0xFE,
+    0x00, 0x00, 0x3F, 0x80, 0xFE, 0x00, 0x00, 0x3F, 0x80, 0xFE, 0x00, 0x00,
+    0x3F, 0x80, 0xFE, 0x00, 0x00, 0x3F, 0x80, 0xFE, 0x00, 0x00, 0x3F, 0x80,
+    0xFE, 0x00, 0x00, 0x3F, 0x80, 0xFE, 0x00, 0x00, 0x3F, 0x80, 0xFE, 0x00,
+    0x00, 0x3F, 0x80, 0xFE, 0x00, 0x00, 0x3F, 0x80, 0xFE, 0x00, 0x00, 0x3F,
+    0x80, 0xFE, 0x00, 0x00, 0x3F, 0x80, 0xFE, 0x00, 0x00, 0x3F, 0x80, 0xFE,
+    0x00, 0x00, 0x3F, 0x80, 0xFE, 0x00, 0x00, 0x3F, 0x80, 0xFE, 0x00, 0x00,
+    0x3F, 0x80, 0xFD, 0xFF, 0xFF, 0xDF, 0x80, 0xFB, 0xFF, 0xFF, 0xEF, 0x80,
+    0xF7, 0xFF, 0xFF, 0xF7, 0x80, 0x6F, 0xFF, 0xFF, 0xFB, 0x00, 0x1F, 0xFF,
+    0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0xF8,
+    0x00, // '6'
+    0x0F, 0xFF, 0xFF, 0xF8, 0x00, 0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0x1F, 0xFF,
+    0xFF, 0xFC, 0x00, 0x6F, 0xFF, 0xFF, 0xFB, 0x00, 0xF7, 0xFF, 0xFF, 0xF7,
+    0x80, 0xFB, 0xFF, 0xFF, 0xEF, 0x80, 0xFD, 0xFF, 0xFF, 0xDF, 0x80, 0xFE,
+    0x00, 0x00, 0x3F, 0x80, 0xFE, 0x00, 0x00, 0x3F, 0x80, 0xFE, 0x00, 0x00,
+    0x3F, 0x80, 0xFE, 0x00, 0x00, 0x3F, 0x80, 0xFE, 0x00, 0x00, 0x3F, 0x80,
+    0xFE, 0x00, 0x00, 0x3F, 0x80, 0xFE, 0x00, 0x00, 0x3F, 0x80, 0xFE, 0x00,
+    0x00, 0x3F, 0x80, 0xFE, 0x00, 0x00, 0x3F, 0x80, 0xFE, 0x00, 0x00, 0x3F,
+    0x80, 0xFE, 0x00, 0x00, 0x3F, 0x80, 0xFE, 0x00, 0x00, 0x3F, 0x80, 0xFE,
+    0x00, 0x00, 0x3F, 0x80, 0xFE, 0x00, 0x00, 0x3F, 0x80, 0xFE, 0x00, 0x00,
+    0x3F, 0x80, 0xFE, 0x00, 0x00, 0x3F, 0x80, 0xFC, 0x00, 0x00, 0x1F, 0x80,
+    0xF8, 0x00, 0x00, 0x0F, 0x80, 0xF0, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x00, 0x0F,
+    0x80, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00,
+    0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00,
+    0x3F, 0x80, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x3F, 0x80,
+    0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00,
+    0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x3F,
+    0x80, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00,
+    0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00,
+    0x3F, 0x80, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x0F, 0x80,
+    0x00, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, // '7'
+    0x0F, 0xFF, 0xFF, 0xF8, 0x00, 0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0x1F, 0xFF,
+    0xFF, 0xFC, 0x00, 0x6F, 0xFF, 0xFF, 0xFB, 0x00, 0xF7, 0xFF, 0xFF, 0xF7,
+    0x80, 0xFB, 0xFF, 0xFF, 0xEF, 0x80, 0xFD, 0xFF, 0xFF, 0xDF, 0x80, 0xFE,
+    0x00, 0x00, 0x3F, 0x80, 0xFE, 0x00, 0x00, 0x3F, 0x80, 0xFE, 0x00, 0x00,
+    0x3F, 0x80, 0xFE, 0x00, 0x00, 0x3F, 0x80, 0xFE, 0x00, 0x00, 0x3F, 0x80,
+    0xFE, 0x00, 0x00, 0x3F, 0x80, 0xFE, 0x00, 0x00, 0x3F, 0x80, 0xFE, 0x00,
+    0x00, 0x3F, 0x80, 0xFE, 0x00, 0x00, 0x3F, 0x80, 0xFE, 0x00, 0x00, 0x3F,
+    0x80, 0xFE, 0x00, 0x00, 0x3F, 0x80, 0xFE, 0x00, 0x00, 0x3F, 0x80, 0xFE,
+    0x00, 0x00, 0x3F, 0x80, 0xFE, 0x00, 0x00, 0x3F, 0x80, 0xFE, 0x00, 0x00,
+    0x3F, 0x80, 0xFE, 0x00, 0x00, 0x3F, 0x80, 0xFD, 0xFF, 0xFF, 0xDF, 0x80,
+    0xFB, 0xFF, 0xFF, 0xEF, 0x80, 0xF7, 0xFF, 0xFF, 0xF7, 0x80, 0x0F, 0xFF,
+    0xFF, 0xF8, 0x00, 0xF7, 0xFF, 0xFF, 0xF7, 0x80, 0xFB, 0xFF, 0xFF, 0xEF,
+    0x80, 0xFD, 0xFF, 0xFF, 0xDF, 0x80, 0xFE, 0x00, 0x00, 0x3F, 0x80, 0xFE,
+    0x00, 0x00, 0x3F, 0x80, 0xFE, 0x00, 0x00, 0x3F, 0x80, 0xFE, 0x00, 0x00,
+    0x3F, 0x80, 0xFE, 0x00, 0x00, 0x3F, 0x80, 0xFE, 0x00, 0x00, 0x3F, 0x80,
+    0xFE, 0x00, 0x00, 0x3F, 0x80, 0xFE, 0x00, 0x00, 0x3F, 0x80, 0xFE, 0x00,
+    0x00, 0x3F, 0x80, 0xFE, 0x00, 0x00, 0x3F, 0x80, 0xFE, 0x00, 0x00, 0x3F,
+    0x80, 0xFE, 0x00, 0x00, 0x3F, 0x80, 0xFE, 0x00, 0x00, 0x3F, 0x80, 0xFE,
+    0x00, 0x00, 0x3F, 0x80, 0xFE, 0x00, 0x00, 0x3F, 0x80, 0xFE, 0x00, 0x00,
+    0x3F, 0x80, 0xFD, 0xFF, 0xFF, 0xDF, 0x80, 0xFB, 0xFF, 0xFF, 0xEF, 0x80,
+    0xF7, 0xFF, 0xFF, 0xF7, 0x80, 0x6F, 0xFF, 0xFF, 0xFB, 0x00, 0x1F, 0xFF,
+    0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0xF8,
+    0x00, // '8'
+    0x0F, 0xFF, 0xFF, 0xF8, 0x00, 0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0x1F, 0xFF,
+    0xFF, 0xFC, 0x00, 0x6F, 0xFF, 0xFF, 0xFB, 0x00, 0xF7, 0xFF, 0xFF, 0xF7,
+    0x80, 0xFB, 0xFF, 0xFF, 0xEF, 0x80, 0xFD, 0xFF, 0xFF, 0xDF, 0x80, 0xFE,
+    0x00, 0x00, 0x3F, 0x80, 0xFE, 0x00, 0x00, 0x3F, 0x80, 0xFE, 0x00, 0x00,
+    0x3F, 0x80, 0xFE, 0x00, 0x00, 0x3F, 0x80, 0xFE, 0x00, 0x00, 0x3F, 0x80,
+    0xFE, 0x00, 0x00, 0x3F, 0x80, 0xFE, 0x00, 0x00, 0x3F, 0x80, 0xFE, 0x00,
+    0x00, 0x3F, 0x80, 0xFE, 0x00, 0x00, 0x3F, 0x80, 0xFE, 0x00, 0x00, 0x3F,
+    0x80, 0xFE, 0x00, 0x00, 0x3F, 0x80, 0xFE, 0x00, 0x00, 0x3F, 0x80, 0xFE,
+    0x00, 0x00, 0x3F, 0x80, 0xFE, 0x00, 0x00, 0x3F, 0x80, 0xFE, 0x00, 0x00,
+    0x3F, 0x80, 0xFE, 0x00, 0x00, 0x3F, 0x80, 0xFD, 0xFF, 0xFF, 0xDF, 0x80,
+    0xFB, 0xFF, 0xFF, 0xEF, 0x80, 0xF7, 0xFF, 0xFF, 0xF7, 0x80, 0x0F, 0xFF,
+    0xFF, 0xF8, 0x00, 0x07, 0xFF, 0xFF, 0xF7, 0x80, 0x03, 0xFF, 0xFF, 0xEF,
+    0x80, 0x01, 0xFF, 0xFF, 0xDF, 0x80, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00,
+    0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00,
+    0x3F, 0x80, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x3F, 0x80,
+    0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00,
+    0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x3F,
+    0x80, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00,
+    0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00,
+    0x3F, 0x80, 0x01, 0xFF, 0xFF, 0xDF, 0x80, 0x03, 0xFF, 0xFF, 0xEF, 0x80,
+    0x07, 0xFF, 0xFF, 0xF7, 0x80, 0x0F, 0xFF, 0xFF, 0xFB, 0x00, 0x1F, 0xFF,
+    0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0xF8,
+    0x00, // '9'
+    0x38, 0x7C, 0xFC, 0xFE, 0xFC, 0x7C, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0xFC,
+    0xFE, 0xFE, 0xFC, 0x7C, // ':'
+};
+const WatchyAtlasGlyph DSEG7_Classic_Bold_53AtlasGlyphs[] PROGMEM = {
+    // bitmapOffset, width, height, xAdvance, xOffset, yOffset
+    {0, 26, 7, 44, 9, -30}, // '-'
+    {28, 7, 7, 1, -3, -7}, // '.'
+    {35, 15, 36, 20, 2, -36}, // '/'
+    {107, 34, 53, 44, 5, -53}, // '0'
+    {372, 8, 49, 44, 31, -51}, // '1'
+    {421, 34, 53, 44, 5, -53}, // '2'
+    {686, 31, 53, 44, 8, -53}, // '3'
+    {898, 34, 49, 44, 5, -51}, // '4'
+    {1143, 34, 53, 44, 5, -53}, // '5'
+    {1408, 34, 53, 44, 5, -53}, // '6'
+    {1673, 34, 51, 44, 5, -53}, // '7'
+    {1928, 34, 53, 44, 5, -53}, // '8'
+    {2193, 34, 53, 44, 5, -53}, // '9'
+    {2458, 8, 28, 12, 2, -40}  // ':'
+};
+const WatchyGlyphAtlas DSEG7_Classic_Bold_53Atlas PROGMEM = {
+    DSEG7_Classic_Bold_53AtlasBitmaps,
+    DSEG7_Classic_Bold_53AtlasGlyphs,
+    0x2D, 0x3A, 58};
+
+// Approx. 2610 bytes
@@ -1,7 +1,7 @@
 #include "Watchy.h"
 
 WatchyRTC Watchy::RTC;
-GxEPD2_BW<GxEPD2_154_D67, GxEPD2_154_D67::HEIGHT> Watchy::display(
+WatchyDisplay Watchy::display(
     GxEPD2_154_D67(DISPLAY_CS, DISPLAY_DC, DISPLAY_RES, DISPLAY_BUSY));
 
 RTC_DATA_ATTR int guiState;
@@ -10,64 +10,134 @@ RTC_DATA_ATTR BMA423 sensor;
 RTC_DATA_ATTR bool WIFI_CONFIGURED;
 RTC_DATA_ATTR bool BLE_CONFIGURED;
 RTC_DATA_ATTR weatherData currentWeather;
-RTC_DATA_ATTR int weatherIntervalCounter = -1;
+RTC_DATA_ATTR bool weatherWanted; // a face called getWeatherData()
+RTC_DATA_ATTR uint32_t weatherMaxAge; // s, from the last weather response
 RTC_DATA_ATTR bool displayFullInit       = true;
+RTC_DATA_ATTR uint8_t backgroundLayer     = BACKGROUND_UNKNOWN;
+RTC_DATA_ATTR uint8_t stillMinutes; // ticks without motion, saturating
+RTC_DATA_ATTR bool anyMotionMapped; // any-motion drives INT1, see deepSleep()
+RTC_DATA_ATTR wifiCache wifiLast;
+static bool wristRaised; // tilt seen since the last tick, this wake only
+static int8_t weatherJob = -1; // WatchyNet job, see addNetworkJobs()
 
 void Watchy::init(String datetime) {
   esp_sleep_wakeup_cause_t wakeup_reason;
   wakeup_reason = esp_sleep_get_wakeup_cause(); // get wake up reason
-  Wire.begin(SDA, SCL);                         // init i2c
+  WatchyTrace::begin(wakeup_reason);
+  WatchyTrace::start(TRACE_I2C);
+  Wire.begin(SDA, SCL); // init i2c
   RTC.init();
+  if (wakeup_reason == ESP_SLEEP_WAKEUP_EXT0 ||
+      wakeup_reason == ESP_SLEEP_WAKEUP_EXT1) {
+    // only upload the config again if the sensor lost it while we slept
+    if (!sensor.restore(WatchyI2C::read, WatchyI2C::write, delay)) {
+      _bmaConfig();
+    }
+  }
+  WatchyTrace::stop(TRACE_I2C);
 
   // Init the display here for all cases, if unused, it will do nothing
+  WatchyTrace::start(TRACE_DISPLAY_INIT);
   display.init(0, displayFullInit, 10,
                true); // 10ms by spec, and fast pulldown reset
   display.epd2.setBusyCallback(displayBusyCallback);
+  WatchyTrace::stop(TRACE_DISPLAY_INIT);
+  addNetworkJobs();
 
   switch (wakeup_reason) {
-  case ESP_SLEEP_WAKEUP_EXT0: // RTC Alarm
+  case ESP_SLEEP_WAKEUP_EXT0: { // RTC Alarm
+    uint8_t wakes = RTC.pendingWakes();
+    if (wakes & RTC_WAKE_SCHEDULED) {
+      onScheduledWake();
+    }
+    if (!(wakes & RTC_WAKE_TICK)) {
+      break;
+    }
+    _handleAccelEvents(true);
+    RTC.read(currentTime);
+    _logHistory(); // before the face gets a chance to reset the step counter
     if (guiState == WATCHFACE_STATE) {
-      RTC.read(currentTime);
       showWatchFace(true); // partial updates on tick
+      _runNetworkJobs();   // after the face, so WiFi never holds up the time
+      _runSeconds();
     }
     break;
-  case ESP_SLEEP_WAKEUP_EXT1: // button Press
-    handleButtonPress();
+  }
+  case ESP_SLEEP_WAKEUP_EXT1: { // button Press, accelerometer event, or both
+    uint64_t wakeupBits = esp_sleep_get_ext1_wakeup_status();
+    bool buttonPressed  = wakeupBits & BTN_PIN_MASK;
+    if (wakeupBits & ACC_INT_MASK) {
+      // a wrist raise, or motion after slow stationary ticks, gets a fresh
+      // face; other events only reach their handlers. A press in the same
+      // wake redraws anyway.
+      if (_handleAccelEvents(false) && guiState == WATCHFACE_STATE &&
+          !buttonPressed) {
+        RTC.read(currentTime);
+        showWatchFace(true);
+      }
+    }
+    if (buttonPressed) {
+      stillMinutes = 0; // buttons mean the watch is in use
+      handleButtonPress();
+    }
     break;
+  }
   default: // reset
-    RTC.config(datetime);
+    invalidateBackgroundLayer(); // firmware may have changed
+    RTC.config(datetime.c_str());
     _bmaConfig();
     RTC.read(currentTime);
     showWatchFace(false); // full update on reset
+    _resetNetworkJobs();
     break;
   }
   deepSleep();
 }
 
 void Watchy::displayBusyCallback(const void *) {
+  uint32_t start = micros();
   gpio_wakeup_enable((gpio_num_t)DISPLAY_BUSY, GPIO_INTR_LOW_LEVEL);
   esp_sleep_enable_gpio_wakeup();
   esp_light_sleep_start();
+  WatchyTrace::add(TRACE_BUSY, micros() - start);
 }
 
 void Watchy::deepSleep() {
+  WatchyTrace::start(TRACE_HIBERNATE);
   display.hibernate();
   displayFullInit = false; // Notify not to init it again
-  RTC.clearAlarm();        // resets the alarm flag in the RTC
-                    // Set pins 0-39 to input to avoid power leaking out
+  // while the watch lies still, tick every STATIONARY_INTERVAL minutes and
+  // let the accelerometer wake us as soon as it moves. While it is worn,
+  // any-motion would wake us on every gesture, so only the rarer events
+  // (tilt, double tap, FIFO watermark, ...) stay on INT1.
+  bool stationary = stillMinutes >= STATIONARY_MINUTES;
+  if (stationary != anyMotionMapped &&
+      sensor.enableAnyNoMotionInterrupt(stationary)) {
+    anyMotionMapped = stationary;
+  }
+  RTC.clearAlarm(stationary ? STATIONARY_INTERVAL
+                            : 1); // resets the alarm flag in the RTC
+  // Set pins 0-39 to input to avoid power leaking out
   for (int i = 0; i < 40; i++) {
     pinMode(i, INPUT);
   }
+  WatchyTrace::stop(TRACE_HIBERNATE);
+  WatchyTrace::commit();
   esp_sleep_enable_ext0_wakeup((gpio_num_t)RTC_INT_PIN,
                                0); // enable deep sleep wake on RTC interrupt
   esp_sleep_enable_ext1_wakeup(
-      BTN_PIN_MASK,
+      BTN_PIN_MASK | ACC_INT_MASK,
       ESP_EXT1_WAKEUP_ANY_HIGH); // enable deep sleep wake on button press
+                                 // or accelerometer interrupt
   esp_deep_sleep_start();
 }
 
 void Watchy::handleButtonPress() {
-  uint64_t wakeupBit = esp_sleep_get_ext1_wakeup_status();
+  handleButtonPress(esp_sleep_get_ext1_wakeup_status());
+}
+
+// wakeupBit holds the *_BTN_MASK of the button that was pressed
+void Watchy::handleButtonPress(uint64_t wakeupBit) {
   // Menu Button
   if (wakeupBit & MENU_BTN_MASK) {
     if (guiState ==
@@ -97,6 +167,9 @@ void Watchy::handleButtonPress() {
       case 6:
         showSyncNTP();
         break;
+      case 7:
+        showTrace();
+        break;
       default:
         break;
       }
@@ -143,78 +216,68 @@ void Watchy::handleButtonPress() {
   }
 
   /***************** fast menu *****************/
-  bool timeout     = false;
-  long lastTimeout = millis();
-  pinMode(MENU_BTN_PIN, INPUT);
-  pinMode(BACK_BTN_PIN, INPUT);
-  pinMode(UP_BTN_PIN, INPUT);
-  pinMode(DOWN_BTN_PIN, INPUT);
-  while (!timeout) {
-    if (millis() - lastTimeout > 5000) {
-      timeout = true;
-    } else {
-      if (digitalRead(MENU_BTN_PIN) == 1) {
-        lastTimeout = millis();
-        if (guiState ==
-            MAIN_MENU_STATE) { // if already in menu, then select menu item
-          switch (menuIndex) {
-          case 0:
-            showAbout();
-            break;
-          case 1:
-            showBuzz();
-            break;
-          case 2:
-            showAccelerometer();
-            break;
-          case 3:
-            setTime();
-            break;
-          case 4:
-            setupWifi();
-            break;
-          case 5:
-            showUpdateFW();
-            break;
-          case 6:
-            showSyncNTP();
-            break;
-          default:
-            break;
-          }
-        } else if (guiState == FW_UPDATE_STATE) {
-          updateFWBegin();
-        }
-      } else if (digitalRead(BACK_BTN_PIN) == 1) {
-        lastTimeout = millis();
-        if (guiState ==
-            MAIN_MENU_STATE) { // exit to watch face if already in menu
-          RTC.read(currentTime);
-          showWatchFace(false);
-          break; // leave loop
-        } else if (guiState == APP_STATE) {
-          showMenu(menuIndex, false); // exit to menu if already in app
-        } else if (guiState == FW_UPDATE_STATE) {
-          showMenu(menuIndex, false); // exit to menu if already in app
+  WatchyInput::begin();
+  uint8_t event;
+  while ((event = WatchyInput::wait(INPUT_MENU_TIMEOUT_MS)) != BUTTON_NONE) {
+    if (event == BUTTON_MENU) {
+      if (guiState ==
+          MAIN_MENU_STATE) { // if already in menu, then select menu item
+        switch (menuIndex) {
+        case 0:
+          showAbout();
+          break;
+        case 1:
+          showBuzz();
+          break;
+        case 2:
+          showAccelerometer();
+          break;
+        case 3:
+          setTime();
+          break;
+        case 4:
+          setupWifi();
+          break;
+        case 5:
+          showUpdateFW();
+          break;
+        case 6:
+          showSyncNTP();
+          break;
+        case 7:
+          showTrace();
+          break;
+        default:
+          break;
         }
-      } else if (digitalRead(UP_BTN_PIN) == 1) {
-        lastTimeout = millis();
-        if (guiState == MAIN_MENU_STATE) { // increment menu index
-          menuIndex--;
-          if (menuIndex < 0) {
-            menuIndex = MENU_LENGTH - 1;
-          }
-          showFastMenu(menuIndex);
+      } else if (guiState == FW_UPDATE_STATE) {
+        updateFWBegin();
+      }
+    } else if (event == BUTTON_BACK) {
+      if (guiState == MAIN_MENU_STATE) { // exit to watch face if already in menu
+        RTC.read(currentTime);
+        showWatchFace(false);
+        break; // leave loop
+      } else if (guiState == APP_STATE) {
+        showMenu(menuIndex, false); // exit to menu if already in app
+      } else if (guiState == FW_UPDATE_STATE) {
+        showMenu(menuIndex, false); // exit to menu if already in app
+      }
+    } else if (event == BUTTON_UP) {
+      if (guiState == MAIN_MENU_STATE) { // increment menu index
+        menuIndex--;
+        if (menuIndex < 0) {
+          menuIndex = MENU_LENGTH - 1;
         }
-      } else if (digitalRead(DOWN_BTN_PIN) == 1) {
-        lastTimeout = millis();
-        if (guiState == MAIN_MENU_STATE) { // decrement menu index
-          menuIndex++;
-          if (menuIndex > MENU_LENGTH - 1) {
-            menuIndex = 0;
-          }
-          showFastMenu(menuIndex);
+        showFastMenu(menuIndex);
+      }
+    } else if (event == BUTTON_DOWN) {
+      if (guiState == MAIN_MENU_STATE) { // decrement menu index
+        menuIndex++;
+        if (menuIndex > MENU_LENGTH - 1) {
+          menuIndex = 0;
         }
+        showFastMenu(menuIndex);
       }
     }
   }
@@ -232,7 +295,7 @@ void Watchy::showMenu(byte menuIndex, bool partialRefresh) {
   const char *menuItems[] = {
       "About Watchy", "Vibrate Motor", "Show Accelerometer",
       "Set Time",     "Setup WiFi",    "Update Firmware",
-      "Sync NTP"};
+      "Sync NTP",     "Wake Trace"};
   for (int i = 0; i < MENU_LENGTH; i++) {
     yPos = MENU_HEIGHT + (MENU_HEIGHT * i);
     display.setCursor(0, yPos);
@@ -264,7 +327,7 @@ void Watchy::showFastMenu(byte menuIndex) {
   const char *menuItems[] = {
       "About Watchy", "Vibrate Motor", "Show Accelerometer",
       "Set Time",     "Setup WiFi",    "Update Firmware",
-      "Sync NTP"};
+      "Sync NTP",     "Wake Trace"};
   for (int i = 0; i < MENU_LENGTH; i++) {
     yPos = MENU_HEIGHT + (MENU_HEIGHT * i);
     display.setCursor(0, yPos);
@@ -344,77 +407,15 @@ void Watchy::setTime() {
 
   int8_t setIndex = SET_HOUR;
 
-  int8_t blink = 0;
+  int8_t blink = 1;
 
-  pinMode(DOWN_BTN_PIN, INPUT);
-  pinMode(UP_BTN_PIN, INPUT);
-  pinMode(MENU_BTN_PIN, INPUT);
-  pinMode(BACK_BTN_PIN, INPUT);
+  WatchyInput::begin();
+  uint32_t lastInput = millis();
 
   display.setFullWindow();
 
   while (1) {
 
-    if (digitalRead(MENU_BTN_PIN) == 1) {
-      setIndex++;
-      if (setIndex > SET_DAY) {
-        break;
-      }
-    }
-    if (digitalRead(BACK_BTN_PIN) == 1) {
-      if (setIndex != SET_HOUR) {
-        setIndex--;
-      }
-    }
-
-    blink = 1 - blink;
-
-    if (digitalRead(DOWN_BTN_PIN) == 1) {
-      blink = 1;
-      switch (setIndex) {
-      case SET_HOUR:
-        hour == 23 ? (hour = 0) : hour++;
-        break;
-      case SET_MINUTE:
-        minute == 59 ? (minute = 0) : minute++;
-        break;
-      case SET_YEAR:
-        year == 99 ? (year = 0) : year++;
-        break;
-      case SET_MONTH:
-        month == 12 ? (month = 1) : month++;
-        break;
-      case SET_DAY:
-        day == 31 ? (day = 1) : day++;
-        break;
-      default:
-        break;
-      }
-    }
-
-    if (digitalRead(UP_BTN_PIN) == 1) {
-      blink = 1;
-      switch (setIndex) {
-      case SET_HOUR:
-        hour == 0 ? (hour = 23) : hour--;
-        break;
-      case SET_MINUTE:
-        minute == 0 ? (minute = 59) : minute--;
-        break;
-      case SET_YEAR:
-        year == 0 ? (year = 99) : year--;
-        break;
-      case SET_MONTH:
-        month == 1 ? (month = 12) : month--;
-        break;
-      case SET_DAY:
-        day == 1 ? (day = 31) : day--;
-        break;
-      default:
-        break;
-      }
-    }
-
     display.fillScreen(GxEPD_BLACK);
     display.setTextColor(GxEPD_WHITE);
     display.setFont(&DSEG7_Classic_Bold_53);
@@ -471,6 +472,75 @@ void Watchy::setTime() {
     }
     display.print(day);
     display.display(true); // partial refresh
+
+    uint8_t event = WatchyInput::wait(SET_BLINK_MS);
+    if (event == BUTTON_NONE) {
+      if (millis() - lastInput > INPUT_APP_TIMEOUT_MS) {
+        showMenu(menuIndex, false); // idle, leave the clock as it was
+        return;
+      }
+      blink = 1 - blink;
+      continue;
+    }
+    lastInput = millis();
+
+    if (event == BUTTON_MENU) {
+      setIndex++;
+      if (setIndex > SET_DAY) {
+        break;
+      }
+    }
+    if (event == BUTTON_BACK) {
+      if (setIndex != SET_HOUR) {
+        setIndex--;
+      }
+    }
+
+    if (event == BUTTON_DOWN) {
+      blink = 1;
+      switch (setIndex) {
+      case SET_HOUR:
+        hour == 23 ? (hour = 0) : hour++;
+        break;
+      case SET_MINUTE:
+        minute == 59 ? (minute = 0) : minute++;
+        break;
+      case SET_YEAR:
+        year == 99 ? (year = 0) : year++;
+        break;
+      case SET_MONTH:
+        month == 12 ? (month = 1) : month++;
+        break;
+      case SET_DAY:
+        day == 31 ? (day = 1) : day++;
+        break;
+      default:
+        break;
+      }
+    }
+
+    if (event == BUTTON_UP) {
+      blink = 1;
+      switch (setIndex) {
+      case SET_HOUR:
+        hour == 0 ? (hour = 23) : hour--;
+        break;
+      case SET_MINUTE:
+        minute == 0 ? (minute = 59) : minute--;
+        break;
+      case SET_YEAR:
+        year == 0 ? (year = 99) : year--;
+        break;
+      case SET_MONTH:
+        month == 1 ? (month = 12) : month--;
+        break;
+      case SET_DAY:
+        day == 1 ? (day = 31) : day--;
+        break;
+      default:
+        break;
+      }
+    }
   }
 
   tmElements_t tm;
@@ -494,89 +564,250 @@ void Watchy::showAccelerometer() {
 
   Accel acc;
 
-  long previousMillis = 0;
-  long interval       = 200;
+  long interval = 200;
 
   guiState = APP_STATE;
 
-  pinMode(BACK_BTN_PIN, INPUT);
+  WatchyInput::begin();
+  uint32_t lastInput = millis();
 
-  while (1) {
+  while (millis() - lastInput < INPUT_APP_TIMEOUT_MS) {
 
-    unsigned long currentMillis = millis();
-
-    if (digitalRead(BACK_BTN_PIN) == 1) {
+    uint8_t event = WatchyInput::wait(interval);
+    if (event == BUTTON_BACK) {
       break;
     }
+    if (event != BUTTON_NONE) {
+      lastInput = millis();
+    }
 
-    if (currentMillis - previousMillis > interval) {
-      previousMillis = currentMillis;
-      // Get acceleration data
-      bool res          = sensor.getAccel(acc);
-      uint8_t direction = sensor.getDirection();
-      display.fillScreen(GxEPD_BLACK);
-      display.setCursor(0, 30);
-      if (res == false) {
-        display.println("getAccel FAIL");
-      } else {
-        display.print("  X:");
-        display.println(acc.x);
-        display.print("  Y:");
-        display.println(acc.y);
-        display.print("  Z:");
-        display.println(acc.z);
-
-        display.setCursor(30, 130);
-        switch (direction) {
-        case DIRECTION_DISP_DOWN:
-          display.println("FACE DOWN");
-          break;
-        case DIRECTION_DISP_UP:
-          display.println("FACE UP");
-          break;
-        case DIRECTION_BOTTOM_EDGE:
-          display.println("BOTTOM EDGE");
-          break;
-        case DIRECTION_TOP_EDGE:
-          display.println("TOP EDGE");
-          break;
-        case DIRECTION_RIGHT_EDGE:
-          display.println("RIGHT EDGE");
-          break;
-        case DIRECTION_LEFT_EDGE:
-          display.println("LEFT EDGE");
-          break;
-        default:
-          display.println("ERROR!!!");
-          break;
-        }
+    // Get acceleration data
+    bool res          = sensor.getAccel(acc);
+    uint8_t direction = sensor.getDirection();
+    display.fillScreen(GxEPD_BLACK);
+    display.setCursor(0, 30);
+    if (res == false) {
+      display.println("getAccel FAIL");
+    } else {
+      display.print("  X:");
+      display.println(acc.x);
+      display.print("  Y:");
+      display.println(acc.y);
+      display.print("  Z:");
+      display.println(acc.z);
+
+      display.setCursor(30, 130);
+      switch (direction) {
+      case DIRECTION_DISP_DOWN:
+        display.println("FACE DOWN");
+        break;
+      case DIRECTION_DISP_UP:
+        display.println("FACE UP");
+        break;
+      case DIRECTION_BOTTOM_EDGE:
+        display.println("BOTTOM EDGE");
+        break;
+      case DIRECTION_TOP_EDGE:
+        display.println("TOP EDGE");
+        break;
+      case DIRECTION_RIGHT_EDGE:
+        display.println("RIGHT EDGE");
+        break;
+      case DIRECTION_LEFT_EDGE:
+        display.println("LEFT EDGE");
+        break;
+      default:
+        display.println("ERROR!!!");
+        break;
       }
-      display.display(true); // full refresh
     }
+    display.display(true); // full refresh
   }
 
   showMenu(menuIndex, false);
 }
 
+void Watchy::showTrace() {
+  display.setFullWindow();
+  display.fillScreen(GxEPD_BLACK);
+  display.setFont(&FreeMonoBold9pt7b);
+  display.setTextColor(GxEPD_WHITE);
+  display.setCursor(0, 20);
+
+  display.print("Wakes: ");
+  display.println(WatchyTrace::count());
+  display.println("ms       p50   p90");
+  for (uint8_t i = 0; i < TRACE_PHASES; i++) {
+    display.printf("%-5s %6.1f%6.1f\n", WatchyTrace::phaseName(i),
+                   WatchyTrace::percentile(i, 50) / 1000.0f,
+                   WatchyTrace::percentile(i, 90) / 1000.0f);
+  }
+  for (uint8_t i = 0; i < TRACE_EVENTS; i++) {
+    const traceEventStats &stats = WatchyTrace::eventStats(i);
+    if (stats.count > 0) {
+      display.printf("%-5s %6.1f last\n", WatchyTrace::eventName(i),
+                     stats.lastUs / 1000.0f);
+    }
+  }
+  display.display(false); // full refresh
+
+  // full histograms go to the serial port
+  Serial.begin(115200);
+  WatchyTrace::dump(Serial);
+  Serial.flush();
+
+  guiState = APP_STATE;
+}
+
 void Watchy::showWatchFace(bool partialRefresh) {
   display.setFullWindow();
-  drawWatchFace();
-  display.display(partialRefresh); // partial refresh
+  WatchyTrace::start(TRACE_DRAW);
+  _drawLayers();
+  WatchyTrace::stop(TRACE_DRAW);
+  WatchyTrace::start(TRACE_DISPLAY);
+  if (partialRefresh && _fullRefreshDue()) {
+    partialRefresh = false;
+  }
+  if (partialRefresh) {
+    display.displayChanges(); // only push what changed since the last frame
+  } else {
+    display.display(false); // full refresh
+  }
+  WatchyTrace::stop(TRACE_DISPLAY);
   guiState = WATCHFACE_STATE;
 }
 
 void Watchy::drawWatchFace() {
-  display.setFont(&DSEG7_Classic_Bold_53);
+  char time[6];
+  snprintf(time, sizeof(time), "%02d:%02d", currentTime.Hour,
+           currentTime.Minute);
   display.setCursor(5, 53 + 60);
-  if (currentTime.Hour < 10) {
-    display.print("0");
+  display.printAtlas(&DSEG7_Classic_Bold_53Atlas, time);
+}
+
+bool Watchy::drawBackgroundLayer() { return false; }
+
+const uint8_t *Watchy::getBackgroundBitmap() { return NULL; }
+
+refreshPolicy Watchy::getRefreshPolicy() {
+  return {REFRESH_PARTIALS, REFRESH_PIXELS, REFRESH_MAX_PARTIALS};
+}
+
+// A full refresh clears the ghosting left by partial updates, but it is the
+// most expensive thing the panel does and flashes the whole screen. Once
+// the face's budget of partial updates is spent, the refresh waits for a
+// tick where it is cheap to take: the top of the hour, or the first tick
+// after a wrist raise. maxPartials bounds the wait.
+bool Watchy::_fullRefreshDue() {
+  refreshPolicy policy = getRefreshPolicy();
+  uint16_t partials    = display.partialUpdates();
+  if (partials < policy.partials && display.partialPixels() < policy.pixels) {
+    return false;
+  }
+  return currentTime.Minute == 0 || wristRaised ||
+         partials >= policy.maxPartials;
+}
+
+void Watchy::invalidateBackgroundLayer() {
+  backgroundLayer = BACKGROUND_UNKNOWN;
+}
+
+// A face's static layer (drawBackgroundLayer) is rasterized once after a
+// reset and kept in NVS. Every other tick it is copied straight into the
+// framebuffer and only the dynamic layer (drawWatchFace) is drawn on top.
+// RTC slow memory already holds the panel mirror, and RTC fast memory is not
+// accessible from the core Arduino runs on, so flash is the only place a
+// second 5000 byte frame survives deep sleep. A background that already is a
+// bitmap in flash (getBackgroundBitmap) skips NVS: an opaque blit of it is a
+// plain pass over 5000 mapped bytes, an NVS read looks the blob up by key,
+// reads it back in chunks and checks each chunk's CRC.
+void Watchy::_drawLayers() {
+  const uint8_t *bitmap = getBackgroundBitmap();
+  if (bitmap != NULL) {
+    display.drawBitmap(0, 0, bitmap, DISPLAY_WIDTH, DISPLAY_HEIGHT,
+                       GxEPD_BLACK, GxEPD_WHITE);
+    drawWatchFace();
+    return;
   }
-  display.print(currentTime.Hour);
-  display.print(":");
-  if (currentTime.Minute < 10) {
-    display.print("0");
+  Preferences prefs;
+  if (backgroundLayer == BACKGROUND_CACHED) {
+    prefs.begin("watchy", true);
+    if (prefs.getBytes("bgLayer", display.getBuffer(),
+                       WatchyDisplay::BUFFER_SIZE) !=
+        WatchyDisplay::BUFFER_SIZE) {
+      backgroundLayer = BACKGROUND_UNKNOWN;
+    }
+    prefs.end();
   }
-  display.println(currentTime.Minute);
+  if (backgroundLayer == BACKGROUND_UNKNOWN) {
+    backgroundLayer = BACKGROUND_NONE;
+    if (drawBackgroundLayer()) {
+      prefs.begin("watchy", false);
+      size_t stored = prefs.putBytes("bgLayer", display.getBuffer(),
+                                     WatchyDisplay::BUFFER_SIZE);
+      prefs.end();
+      backgroundLayer = stored == WatchyDisplay::BUFFER_SIZE
+                            ? BACKGROUND_CACHED
+                            : BACKGROUND_UNCACHED;
+    }
+  } else if (backgroundLayer == BACKGROUND_UNCACHED) {
+    drawBackgroundLayer();
+  }
+  drawWatchFace();
+}
+
+void Watchy::benchmarkWatchFace() {
+  // Renders the watch face for all 1440 minutes of a day into the
+  // framebuffer without refreshing the panel, then prints min/mean/p99
+  // render time and framebuffer checksums to Serial. Call it from setup()
+  // instead of init() to compare the CPU cost of faces and drawing paths,
+  // or run every example face on a PC with extras/host. No network jobs
+  // are added, so faces get the cached weather. A configured BMA423 is
+  // only reattached, a full config would reset its step counter.
+  Serial.begin(115200);
+  Wire.begin(SDA, SCL);
+  RTC.init();
+  display.init(0, displayFullInit, 10, true);
+  if (!sensor.restore(WatchyI2C::read, WatchyI2C::write, delay)) {
+    _bmaConfig();
+  }
+  RTC.read(currentTime);
+  invalidateBackgroundLayer();
+
+  const uint16_t frames = 24 * 60;
+  uint32_t *renderTimes = new uint32_t[frames];
+  uint32_t dayChecksum  = 2166136261UL;
+  uint64_t totalTime    = 0;
+
+  Serial.println("hour  checksum");
+  for (uint16_t i = 0; i < frames; i++) {
+    currentTime.Hour   = i / 60;
+    currentTime.Minute = i % 60;
+    currentTime.Second = 0;
+    display.setFullWindow();
+    display.fillScreen(GxEPD_WHITE);
+
+    uint32_t start = micros();
+    _drawLayers();
+    renderTimes[i] = micros() - start;
+    totalTime      += renderTimes[i];
+
+    uint32_t frameChecksum = display.checksum();
+    dayChecksum            = (dayChecksum ^ frameChecksum) * 16777619UL;
+    if (currentTime.Minute == 0) {
+      Serial.printf("%02d:00 %08x\n", currentTime.Hour, frameChecksum);
+    }
+  }
+
+  std::sort(renderTimes, renderTimes + frames);
+  Serial.printf("frames: %u (%s blit)\n", frames,
+                display.fastBlit ? "fast" : "per-pixel");
+  Serial.printf("min: %u us\n", renderTimes[0]);
+  Serial.printf("mean: %u us\n", (uint32_t)(totalTime / frames));
+  Serial.printf("p99: %u us\n", renderTimes[frames * 99 / 100]);
+  Serial.printf("max: %u us\n", renderTimes[frames - 1]);
+  Serial.printf("day checksum: %08x\n", dayChecksum);
+  delete[] renderTimes;
 }
 
 weatherData Watchy::getWeatherData() {
@@ -585,87 +816,204 @@ weatherData Watchy::getWeatherData() {
                         settings.weatherAPIKey, settings.weatherUpdateInterval);
 }
 
+// The weather is fetched by a network job after the face is drawn, so this
+// returns what the last session got, or the copy in flash after a reset.
+// The arguments are used from then on. Nothing here brings WiFi up.
 weatherData Watchy::getWeatherData(String cityID, String units, String lang,
                                    String url, String apiKey,
                                    uint8_t updateInterval) {
-  currentWeather.isMetric = units == String("metric");
-  if (weatherIntervalCounter < 0) { //-1 on first run, set to updateInterval
-    weatherIntervalCounter = updateInterval;
-  }
-  if (weatherIntervalCounter >=
-      updateInterval) { // only update if WEATHER_UPDATE_INTERVAL has elapsed
-                        // i.e. 30 minutes
-    if (connectWiFi()) {
-      HTTPClient http; // Use Weather API for live data if WiFi is connected
-      http.setConnectTimeout(3000); // 3 second max timeout
-      String weatherQueryURL = url + cityID + String("&units=") + units +
-                               String("&lang=") + lang + String("&appid=") +
-                               apiKey;
-      http.begin(weatherQueryURL.c_str());
-      int httpResponseCode = http.GET();
-      if (httpResponseCode == 200) {
-        String payload             = http.getString();
-        JSONVar responseObject     = JSON.parse(payload);
-        currentWeather.temperature = int(responseObject["main"]["temp"]);
-        currentWeather.weatherConditionCode =
-            int(responseObject["weather"][0]["id"]);
-        currentWeather.weatherDescription =
-            responseObject["weather"][0]["main"];
-      } else {
-        // http error
-      }
-      http.end();
-      // turn off radios
-      WiFi.mode(WIFI_OFF);
-      btStop();
-    } else { // No WiFi, use internal temperature sensor
-      uint8_t temperature = sensor.readTemperature(); // celsius
-      if (!currentWeather.isMetric) {
-        temperature = temperature * 9. / 5. + 32.; // fahrenheit
+  currentWeather.isMetric        = units == String("metric");
+  settings.cityID                = cityID;
+  settings.weatherUnit           = units;
+  settings.weatherLang           = lang;
+  settings.weatherURL            = url;
+  settings.weatherAPIKey         = apiKey;
+  settings.weatherUpdateInterval = updateInterval;
+  weatherWanted                  = true;
+  if (weatherJob >= 0 && WatchyNet::nextRun(weatherJob) == 0) {
+    // first call since the reset, start from the copy in flash
+    char url[256];
+    httpCacheEntry cache;
+    _weatherURL(url, sizeof(url));
+    if (WatchyHTTPCache::load("weather", url, cache)) {
+      _unpackWeather(cache);
+      weatherMaxAge = cache.maxAge;
+      time_t now    = makeTime(currentTime);
+      if (now >= cache.fetched &&
+          (uint32_t)(now - cache.fetched) < _weatherInterval() * 60UL) {
+        WatchyNet::ranAt(weatherJob, cache.fetched);
       }
-      currentWeather.temperature          = temperature;
-      currentWeather.weatherConditionCode = 800;
     }
-    weatherIntervalCounter = 0;
-  } else {
-    weatherIntervalCounter++;
   }
+  WatchyNet::setInterval(weatherJob, _weatherInterval());
   return currentWeather;
 }
 
-float Watchy::getBatteryVoltage() {
-  if (RTC.rtcType == DS3231) {
-    return analogReadMilliVolts(BATT_ADC_PIN) / 1000.0f *
-           2.0f; // Battery voltage goes through a 1/2 divider.
+bool Watchy::_fetchWeather(bool online) {
+  if (!online) { // No WiFi, use internal temperature sensor
+    uint8_t temperature = sensor.readTemperature(); // celsius
+    if (!currentWeather.isMetric) {
+      temperature = temperature * 9. / 5. + 32.; // fahrenheit
+    }
+    currentWeather.temperature          = temperature;
+    currentWeather.weatherConditionCode = 800;
+    return false;
+  }
+  bool fetched = false;
+  char weatherQueryURL[256];
+  httpCacheEntry cache;
+  _weatherURL(weatherQueryURL, sizeof(weatherQueryURL));
+  WatchyHTTPCache::load("weather", weatherQueryURL, cache);
+  HTTPClient http; // Use Weather API for live data if WiFi is connected
+  http.setConnectTimeout(3000); // 3 second max timeout
+  http.useHTTP10(true);         // no chunked encoding, see WatchyJSON
+  http.begin(weatherQueryURL);
+  uint32_t stored = cache.fetched;
+  int httpResponseCode =
+      WatchyHTTPCache::get(http, cache, makeTime(currentTime));
+  if (httpResponseCode == HTTP_CODE_OK) {
+    // the body is read until these are in, OpenWeatherMap sends them
+    // in its first few hundred bytes
+    static const char *const fields[] = {"main.temp", "weather[0].id",
+                                         "weather[0].main"};
+    WatchyJSON response(fields, 3);
+    if (response.parse(http.getStream())) {
+      currentWeather.temperature          = response.toFloat(0);
+      currentWeather.weatherConditionCode = response.toInt(1);
+      currentWeather.weatherDescription   = response.value(2);
+      _packWeather(cache);
+      WatchyHTTPCache::store("weather", cache);
+      fetched = true;
+    }
+  } else if (httpResponseCode == HTTP_CODE_NOT_MODIFIED) {
+    _unpackWeather(cache); // still what the server has
+    // keep the fetch time across a reset, so the first tick does not fetch
+    // again, but rewrite flash at most once per max-age
+    if (cache.fetched - stored >= cache.maxAge) {
+      WatchyHTTPCache::store("weather", cache);
+    }
+    fetched = true;
   } else {
-    return analogReadMilliVolts(BATT_ADC_PIN) / 1000.0f * 2.0f;
+    // http error
+  }
+  http.end();
+  if (fetched) {
+    weatherMaxAge = cache.maxAge;
+    WatchyNet::setInterval(weatherJob, _weatherInterval());
   }
+  return fetched;
+}
+
+void Watchy::_weatherURL(char *url, size_t size) {
+  snprintf(url, size, "%s%s&units=%s&lang=%s&appid=%s",
+           settings.weatherURL.c_str(), settings.cityID.c_str(),
+           settings.weatherUnit.c_str(), settings.weatherLang.c_str(),
+           settings.weatherAPIKey.c_str());
+}
+
+// The face's interval, stretched to the max-age the server asked for
+uint16_t Watchy::_weatherInterval() {
+  return max((uint32_t)settings.weatherUpdateInterval,
+             min(weatherMaxAge / 60, (uint32_t)UINT16_MAX));
 }
 
-uint16_t Watchy::_readRegister(uint8_t address, uint8_t reg, uint8_t *data,
-                               uint16_t len) {
-  Wire.beginTransmission(address);
-  Wire.write(reg);
-  Wire.endTransmission();
-  Wire.requestFrom((uint8_t)address, (uint8_t)len);
-  uint8_t i = 0;
-  while (Wire.available()) {
-    data[i++] = Wire.read();
+// What the weather cache entry keeps of currentWeather
+typedef struct weatherCacheData {
+  int8_t temperature;
+  int16_t weatherConditionCode;
+  char weatherDescription[HTTP_CACHE_DATA - 4];
+} weatherCacheData;
+
+void Watchy::_packWeather(httpCacheEntry &entry) {
+  weatherCacheData data;
+  data.temperature          = currentWeather.temperature;
+  data.weatherConditionCode = currentWeather.weatherConditionCode;
+  strncpy(data.weatherDescription, currentWeather.weatherDescription.c_str(),
+          sizeof(data.weatherDescription) - 1);
+  data.weatherDescription[sizeof(data.weatherDescription) - 1] = '\0';
+  memcpy(entry.data, &data, sizeof(data));
+  entry.length = sizeof(data);
+}
+
+void Watchy::_unpackWeather(const httpCacheEntry &entry) {
+  if (entry.length != sizeof(weatherCacheData)) {
+    return;
+  }
+  weatherCacheData data;
+  memcpy(&data, entry.data, sizeof(data));
+  currentWeather.temperature          = data.temperature;
+  currentWeather.weatherConditionCode = data.weatherConditionCode;
+  currentWeather.weatherDescription   = data.weatherDescription;
+}
+
+void Watchy::addNetworkJobs() {
+  // weather only once a face has asked for it
+  weatherJob = WatchyNet::add(weatherWanted ? _weatherInterval() : 0,
+                              _weatherJob, this);
+  WatchyNet::add(settings.ntpServer.length() > 0 ? NTP_SYNC_INTERVAL : 0,
+                 _ntpJob, this);
+}
+
+// The first session after a reset runs once the first frame is up, so the
+// face shows the cached weather instead of waiting for WiFi
+void Watchy::_resetNetworkJobs() {
+  weatherData weather = currentWeather;
+  _runNetworkJobs();
+  if (guiState == WATCHFACE_STATE &&
+      (currentWeather.temperature != weather.temperature ||
+       currentWeather.weatherConditionCode != weather.weatherConditionCode ||
+       currentWeather.weatherDescription != weather.weatherDescription)) {
+    RTC.read(currentTime); // NTP may have run too
+    showWatchFace(true);
   }
-  return 0;
 }
 
-uint16_t Watchy::_writeRegister(uint8_t address, uint8_t reg, uint8_t *data,
-                                uint16_t len) {
-  Wire.beginTransmission(address);
-  Wire.write(reg);
-  Wire.write(data, len);
-  return (0 != Wire.endTransmission());
+// One WiFi session for every job that is due or nearly due
+void Watchy::_runNetworkJobs() {
+  time_t now = makeTime(currentTime);
+  if (!WatchyNet::due(now)) {
+    return;
+  }
+  bool online = connectWiFi(); // turns the radios off if it fails
+  WatchyNet::run(now, online);
+  if (online) {
+    _radiosOff();
+  }
+}
+
+void Watchy::_radiosOff() {
+  WiFi.mode(WIFI_OFF);
+  btStop();
+}
+
+bool Watchy::_weatherJob(void *watchy, bool online) {
+  return ((Watchy *)watchy)->_fetchWeather(online);
+}
+
+bool Watchy::_ntpJob(void *watchy, bool online) {
+  return online && ((Watchy *)watchy)->syncNTP();
+}
+
+float Watchy::getBatteryVoltage() {
+  if (RTC.rtcType == DS3231) {
+    return analogReadMilliVolts(BATT_ADC_PIN) / 1000.0f *
+           2.0f; // Battery voltage goes through a 1/2 divider.
+  } else {
+    return analogReadMilliVolts(BATT_ADC_PIN) / 1000.0f * 2.0f;
+  }
 }
 
 void Watchy::_bmaConfig() {
 
-  if (sensor.begin(_readRegister, _writeRegister, delay) == false) {
+  // the ~6 KB config upload dominates, run it at fast mode (all devices on
+  // the bus support 400 kHz)
+  uint32_t clock = Wire.getClock();
+  Wire.setClock(400000);
+  uint32_t start = micros();
+  bool ok        = sensor.begin(WatchyI2C::read, WatchyI2C::write, delay);
+  WatchyTrace::event(TRACE_BMA_BEGIN, micros() - start);
+  Wire.setClock(clock);
+  if (ok == false) {
     // fail to init BMA
     return;
   }
@@ -731,6 +1079,8 @@ void Watchy::_bmaConfig() {
   config.input_en  = BMA4_INPUT_DISABLE;
   // The correct trigger interrupt needs to be configured as needed
   sensor.setINTPinConfig(config, BMA4_INTR1_MAP);
+  // hold INT1 high until the status is read, so ext1 cannot miss a pulse
+  sensor.setINTMode(BMA4_LATCH_MODE);
 
   struct bma423_axes_remap remap_data;
   remap_data.x_axis      = 1;
@@ -748,6 +1098,13 @@ void Watchy::_bmaConfig() {
   sensor.enableFeature(BMA423_TILT, true);
   // Enable BMA423 isDoubleClick feature
   sensor.enableFeature(BMA423_WAKEUP, true);
+  // Enable BMA423 any-motion, ends the slow stationary ticks
+  struct bma423_anymotion_config motion;
+  motion.threshold    = MOTION_THRESHOLD;
+  motion.duration     = MOTION_DURATION;
+  motion.nomotion_sel = 0;
+  sensor.setAnyMotionConfig(motion);
+  sensor.enableAnyMotionAxis();
 
   // Reset steps
   sensor.resetStepCounter();
@@ -757,12 +1114,153 @@ void Watchy::_bmaConfig() {
   sensor.enableTiltInterrupt();
   // It corresponds to isDoubleClick interrupt
   sensor.enableWakeupInterrupt();
+  sensor.enableAnyNoMotionInterrupt();
+  anyMotionMapped = true;
+}
+
+// Reads the interrupt status once per tick or accelerometer wake, which
+// clears it and releases the latched INT1 line, and hands every event
+// latched since the last read to its handler. Events that are not mapped
+// to INT1 still show up on the next tick.
+// Any-motion, or no answer from the BMA423, restarts the stationary count
+// so ticks stay at one per minute; only ticks count towards it. Returns
+// true if the face is worth redrawing: the wrist was raised or the watch
+// moved.
+bool Watchy::_handleAccelEvents(bool tick) {
+  bool status = sensor.getINT();
+  wristRaised = status && sensor.isTilt();
+  bool moved  = !status || sensor.isAnyNoMotion();
+  if (moved) {
+    stillMinutes = 0;
+  } else if (tick && stillMinutes < STATIONARY_MINUTES) {
+    stillMinutes++;
+  }
+  if (!status) {
+    return true;
+  }
+  if (sensor.isFIFOWatermark()) {
+    _drainAccelFIFO();
+  }
+  if (sensor.isTilt()) {
+    onTilt();
+  }
+  if (sensor.isDoubleClick()) {
+    onDoubleTap();
+  }
+  if (sensor.isStepCounter()) {
+    onStep(sensor.getCounter());
+  }
+  if (sensor.isActivity()) {
+    onActivity(sensor.getActivityState());
+  }
+  return moved || wristRaised;
+}
+
+secondsWindow Watchy::getSecondsWindow() { return {0, 0, 0, 0}; }
+
+void Watchy::drawSeconds() {}
+
+// Seconds mode spends the rest of the minute in light sleep and wakes once
+// a second to redraw only the face's seconds window. Ticks are timed with
+// millis() from the RTC seconds read on entry, and stop in time for the next
+// minute alarm to find the watch in deep sleep. Minute ticks take over while
+// the battery is low or the watch is not face up; the BMA423 is asked on
+// the first tick and every SECONDS_WRIST_TICKS after, so the I2C bus is
+// only touched every few seconds. Every tick counts as a partial update, so
+// seconds faces want a larger getRefreshPolicy() budget. The trace records
+// the awake time of each tick as "sec", a proxy for its energy cost: it is
+// not a current measurement and leaves out the light sleep between ticks.
+void Watchy::_runSeconds() {
+  static const uint64_t buttonMasks[] = {0, MENU_BTN_MASK, BACK_BTN_MASK,
+                                         UP_BTN_MASK, DOWN_BTN_MASK};
+  secondsWindow window = getSecondsWindow();
+  if (window.w == 0 || currentTime.Second != 0 ||
+      getBatteryVoltage() < SECONDS_MIN_VOLTAGE) {
+    return;
+  }
+  // phase the ticks on the RTC, the boot after the alarm takes a while
+  RTC.read(currentTime);
+  int32_t minuteStart = (int32_t)millis() - currentTime.Second * 1000;
+  // the RTC only counts whole seconds, so the next minute may start up to
+  // a second early. The last tick and deep sleep have to be done by then,
+  // or the next alarm is cleared before it can wake the watch.
+  int32_t deadline = minuteStart + 59000 - SECONDS_MARGIN_MS;
+  int32_t tickMs   = 0; // how long the last tick took
+  uint8_t ticks    = 0;
+  WatchyInput::begin();
+  for (;;) {
+    int32_t second = ((int32_t)millis() - minuteStart) / 1000 + 1;
+    int32_t tickAt = minuteStart + second * 1000;
+    if (second >= 60 || tickAt + tickMs > deadline) {
+      break;
+    }
+    uint8_t event =
+        WatchyInput::wait(max(tickAt - (int32_t)millis(), (int32_t)0));
+    if (event != BUTTON_NONE) {
+      stillMinutes = 0;
+      handleButtonPress(buttonMasks[event]);
+      return;
+    }
+    uint32_t start = micros();
+    if (ticks++ % SECONDS_WRIST_TICKS == 0 &&
+        sensor.getDirection() != DIRECTION_DISP_UP) {
+      break; // wrist down
+    }
+    currentTime.Second = second;
+    display.setPartialWindow(window.x, window.y, window.w, window.h);
+    drawSeconds();
+    display.display(true);
+    tickMs = (micros() - start) / 1000;
+    WatchyTrace::event(TRACE_SECONDS, micros() - start);
+  }
+  display.setFullWindow();
+}
+
+// The default redraws the face, so a face only has to call
+// RTC.scheduleWake() to get refreshed between ticks
+void Watchy::onScheduledWake() {
+  if (guiState == WATCHFACE_STATE) {
+    RTC.read(currentTime);
+    showWatchFace(true);
+  }
+}
+
+void Watchy::onTilt() {}
+
+void Watchy::onDoubleTap() {}
+
+void Watchy::onStep(uint32_t) {}
+
+void Watchy::onActivity(uint8_t) {}
+
+// One burst read per watermark instead of one wake per sample
+void Watchy::_drainAccelFIFO() {
+  uint8_t buffer[1024];
+  Accel samples[sizeof(buffer) / BMA4_FIFO_A_LENGTH];
+  uint16_t count = sensor.readFIFO(buffer, sizeof(buffer), samples,
+                                   sizeof(samples) / sizeof(samples[0]));
+  if (count > 0) {
+    onAccelSamples(samples, count);
+  }
+}
+
+void Watchy::onAccelSamples(const Accel *, uint16_t) {}
+
+// A time comparison on most ticks, three sensor reads every
+// HISTORY_INTERVAL minutes
+void Watchy::_logHistory() {
+  time_t now = makeTime(currentTime);
+  if (WatchyHistory::due(now)) {
+    WatchyHistory::append(now, sensor.getCounter(), getBatteryVoltage(),
+                          sensor.readTemperature());
+  }
 }
 
 void Watchy::setupWifi() {
   display.epd2.setBusyCallback(0); // temporarily disable lightsleep on busy
   WiFiManager wifiManager;
   wifiManager.resetSettings();
+  wifiLast.channel = 0; // the access point may change
   wifiManager.setTimeout(WIFI_AP_TIMEOUT);
   wifiManager.setAPCallback(_configModeCallback);
   display.setFullWindow();
@@ -777,9 +1275,7 @@ void Watchy::setupWifi() {
     display.println(WiFi.SSID());
   }
   display.display(false); // full refresh
-  // turn off radios
-  WiFi.mode(WIFI_OFF);
-  btStop();
+  _radiosOff();
   display.epd2.setBusyCallback(displayBusyCallback); // enable lightsleep on
                                                      // busy
   guiState = APP_STATE;
@@ -799,22 +1295,54 @@ void Watchy::_configModeCallback(WiFiManager *myWiFiManager) {
   display.display(false); // full refresh
 }
 
+// A reconnect goes straight to the access point and reuses the IP of the
+// last full connect, which skips the channel scan and DHCP. If that fails,
+// or every WIFI_CACHE_USES reconnects to renew the lease, WiFi.begin() does
+// the full connect and refills the cache.
 bool Watchy::connectWiFi() {
-  if (WL_CONNECT_FAILED ==
-      WiFi.begin()) { // WiFi not setup, you can also use hard coded credentials
-                      // with WiFi.begin(SSID,PASS);
-    WIFI_CONFIGURED = false;
-  } else {
-    if (WL_CONNECTED ==
-        WiFi.waitForConnectResult()) { // attempt to connect for 10s
-      WIFI_CONFIGURED = true;
-    } else { // connection failed, time out
-      WIFI_CONFIGURED = false;
-      // turn off radios
-      WiFi.mode(WIFI_OFF);
-      btStop();
+  uint32_t start = micros();
+  bool connected = false;
+  if (wifiLast.channel != 0 && wifiLast.uses < WIFI_CACHE_USES) {
+    wifi_config_t config;
+    WiFi.mode(WIFI_STA);
+    if (esp_wifi_get_config(WIFI_IF_STA, &config) == ESP_OK &&
+        config.sta.ssid[0] != '\0') {
+      WiFi.config(wifiLast.ip, wifiLast.gateway, wifiLast.subnet, wifiLast.dns);
+      WiFi.begin((const char *)config.sta.ssid,
+                 (const char *)config.sta.password, wifiLast.channel,
+                 wifiLast.bssid);
+      connected = WiFi.waitForConnectResult(WIFI_FAST_TIMEOUT) == WL_CONNECTED;
+    }
+    if (connected) {
+      wifiLast.uses++;
+    } else {
+      wifiLast.channel = 0;
+      WiFi.disconnect();
+      WiFi.config(INADDR_NONE, INADDR_NONE, INADDR_NONE); // back to DHCP
     }
   }
+  // begin() fails if WiFi is not setup, you can also use hard coded
+  // credentials with WiFi.begin(SSID,PASS). A failure still turns the radio
+  // off below.
+  if (!connected && WiFi.begin() != WL_CONNECT_FAILED) {
+    connected = WL_CONNECTED ==
+                WiFi.waitForConnectResult(); // attempt to connect for 10s
+    if (connected) {
+      memcpy(wifiLast.bssid, WiFi.BSSID(), sizeof(wifiLast.bssid));
+      wifiLast.channel = WiFi.channel();
+      wifiLast.uses    = 0;
+      wifiLast.ip      = WiFi.localIP();
+      wifiLast.gateway = WiFi.gatewayIP();
+      wifiLast.subnet  = WiFi.subnetMask();
+      wifiLast.dns     = WiFi.dnsIP();
+    }
+  }
+  WIFI_CONFIGURED = connected;
+  if (connected) {
+    WatchyTrace::event(TRACE_WIFI_CONNECT, micros() - start);
+  } else { // connection failed, time out
+    _radiosOff();
+  }
   return WIFI_CONFIGURED;
 }
 
@@ -898,6 +1426,7 @@ void Watchy::updateFWBegin() {
         display.display(false); // full refresh
 
         delay(2000);
+        WatchyHistory::flush(); // RTC memory does not survive the restart
         esp_restart();
       }
       if (currentStatus == 4) {
@@ -918,9 +1447,7 @@ void Watchy::updateFWBegin() {
     delay(100);
   }
 
-  // turn off radios
-  WiFi.mode(WIFI_OFF);
-  btStop();
+  _radiosOff();
   showMenu(menuIndex, false);
 }
 
@@ -958,6 +1485,7 @@ void Watchy::showSyncNTP() {
     } else {
       display.println("NTP Sync Failed");
     }
+    _radiosOff();
   } else {
     display.println("WiFi Not Configured");
   }
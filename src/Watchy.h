@@ -3,15 +3,26 @@
 
 #include <Arduino.h>
 #include <WiFiManager.h>
+#include <esp_wifi.h>
 #include <HTTPClient.h>
 #include <NTPClient.h>
 #include <WiFiUdp.h>
 #include <Arduino_JSON.h>
 #include <GxEPD2_BW.h>
 #include <Wire.h>
+#include <Preferences.h>
 #include <Fonts/FreeMonoBold9pt7b.h>
 #include "DSEG7_Classic_Bold_53.h"
+#include "WatchyI2C.h"
 #include "WatchyRTC.h"
+#include "WatchyDisplay.h"
+#include "DSEG7_Classic_Bold_53Atlas.h"
+#include "WatchyTrace.h"
+#include "WatchyInput.h"
+#include "WatchyHistory.h"
+#include "WatchyJSON.h"
+#include "WatchyNet.h"
+#include "WatchyHTTPCache.h"
 #include "BLE.h"
 #include "bma.h"
 #include "config.h"
@@ -23,6 +34,29 @@ typedef struct weatherData {
   String weatherDescription;
 } weatherData;
 
+// When showWatchFace() trades a partial update for a full refresh, see
+// Watchy::getRefreshPolicy()
+typedef struct refreshPolicy {
+  uint16_t partials;    // partial updates before a full refresh is due
+  uint32_t pixels;      // or pixels flipped by them
+  uint16_t maxPartials; // refresh even if no cheap moment came up
+} refreshPolicy;
+
+// Screen area redrawn every second in seconds mode, panel-aligned by the
+// display. A zero width keeps the face in minute mode.
+typedef struct secondsWindow {
+  int16_t x, y, w, h;
+} secondsWindow;
+
+// The access point and DHCP lease of the last full WiFi connect, so the
+// next one can skip the scan and DHCP, see Watchy::connectWiFi()
+typedef struct wifiCache {
+  uint8_t bssid[6];
+  uint8_t channel; // 0 if the cache is empty
+  uint8_t uses;    // fast reconnects since the lease was taken
+  uint32_t ip, gateway, subnet, dns;
+} wifiCache;
+
 typedef struct watchySettings {
   // Weather Settings
   String cityID;
@@ -40,7 +74,7 @@ typedef struct watchySettings {
 class Watchy {
 public:
   static WatchyRTC RTC;
-  static GxEPD2_BW<GxEPD2_154_D67, GxEPD2_154_D67::HEIGHT> display;
+  static WatchyDisplay display;
   tmElements_t currentTime;
   watchySettings settings;
 
@@ -53,6 +87,7 @@ public:
   void vibMotor(uint8_t intervalMs = 100, uint8_t length = 20);
 
   void handleButtonPress();
+  void handleButtonPress(uint64_t wakeupBit);
   void showMenu(byte menuIndex, bool partialRefresh);
   void showFastMenu(byte menuIndex);
   void showAbout();
@@ -60,6 +95,7 @@ public:
   void showAccelerometer();
   void showUpdateFW();
   void showSyncNTP();
+  void showTrace();
   bool syncNTP();
   bool syncNTP(long gmt, int dst, String ntpServer);
   void setTime();
@@ -73,14 +109,48 @@ public:
   void showWatchFace(bool partialRefresh);
   virtual void drawWatchFace(); // override this method for different watch
                                 // faces
+  virtual bool drawBackgroundLayer(); // override to draw a static layer once,
+                                      // return true if one was drawn
+  // override to return a full screen PROGMEM bitmap drawn under every frame,
+  // instead of drawBackgroundLayer()
+  virtual const uint8_t *getBackgroundBitmap();
+  void invalidateBackgroundLayer();   // redraw the static layer next tick
+  virtual refreshPolicy getRefreshPolicy(); // override to tune ghosting
+  virtual secondsWindow getSecondsWindow(); // override for seconds mode
+  virtual void drawSeconds(); // currentTime.Second into the seconds window
+  virtual void onScheduledWake(); // see RTC.scheduleWake()
+  // override to add jobs to the shared radio session, see WatchyNet. Call
+  // Watchy::addNetworkJobs() first.
+  virtual void addNetworkJobs();
+  // accelerometer events, read once per tick or INT1 wake
+  virtual void onTilt(); // wrist raised
+  virtual void onDoubleTap();
+  virtual void onStep(uint32_t steps);       // step counter watermark
+  virtual void onActivity(uint8_t activity); // BMA423_USER_*
+  virtual void onAccelSamples(const Accel *samples,
+                              uint16_t count); // FIFO watermark, see
+                                               // sensor.enableFIFO()
+  void benchmarkWatchFace(); // render a whole day headless, report over Serial
 
 private:
+  void _drawLayers();
   void _bmaConfig();
+  bool _handleAccelEvents(bool tick);
+  void _drainAccelFIFO();
+  void _logHistory();
+  void _runSeconds();
+  void _runNetworkJobs();
+  void _resetNetworkJobs();
+  bool _fetchWeather(bool online);
+  void _weatherURL(char *url, size_t size);
+  uint16_t _weatherInterval();
+  static void _packWeather(httpCacheEntry &entry);
+  static void _unpackWeather(const httpCacheEntry &entry);
+  void _radiosOff();
+  static bool _weatherJob(void *watchy, bool online);
+  static bool _ntpJob(void *watchy, bool online);
+  bool _fullRefreshDue();
   static void _configModeCallback(WiFiManager *myWiFiManager);
-  static uint16_t _readRegister(uint8_t address, uint8_t reg, uint8_t *data,
-                                uint16_t len);
-  static uint16_t _writeRegister(uint8_t address, uint8_t reg, uint8_t *data,
-                                 uint16_t len);
 };
 
 extern RTC_DATA_ATTR int guiState;
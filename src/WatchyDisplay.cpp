@@ -0,0 +1,457 @@
+#include "WatchyDisplay.h"
+
+// What the panel currently shows, kept across deep sleep so the next frame
+// can be diffed against it
+RTC_DATA_ATTR uint8_t panelFrame[WatchyDisplay::BUFFER_SIZE];
+RTC_DATA_ATTR bool panelFrameValid;
+// Ghosting accumulates with partial updates until the next full refresh
+RTC_DATA_ATTR uint16_t partialUpdateCount;
+RTC_DATA_ATTR uint32_t partialPixelCount;
+
+WatchyDisplay::WatchyDisplay(GxEPD2_154_D67 epd2_instance)
+    : Adafruit_GFX(GxEPD2_154_D67::WIDTH, GxEPD2_154_D67::HEIGHT),
+      epd2(epd2_instance) {
+  setFullWindow();
+}
+
+void WatchyDisplay::init(uint32_t serial_diag_bitrate) {
+  epd2.init(serial_diag_bitrate);
+  setFullWindow();
+}
+
+void WatchyDisplay::init(uint32_t serial_diag_bitrate, bool initial,
+                         uint16_t reset_duration, bool pulldown_rst_mode) {
+  epd2.init(serial_diag_bitrate, initial, reset_duration, pulldown_rst_mode);
+  setFullWindow();
+}
+
+void WatchyDisplay::drawPixel(int16_t x, int16_t y, uint16_t color) {
+  if ((x < 0) || (x >= width()) || (y < 0) || (y >= height())) {
+    return;
+  }
+  switch (getRotation()) {
+  case 1:
+    _swap_int16_t(x, y);
+    x = WIDTH - x - 1;
+    break;
+  case 2:
+    x = WIDTH - x - 1;
+    y = HEIGHT - y - 1;
+    break;
+  case 3:
+    _swap_int16_t(x, y);
+    y = HEIGHT - y - 1;
+    break;
+  }
+  // clip to (partial) window
+  if ((x < _pw_x) || (x >= _pw_x + _pw_w) || (y < _pw_y) ||
+      (y >= _pw_y + _pw_h)) {
+    return;
+  }
+  uint16_t i = x / 8 + y * WIDTH_BYTES;
+  if (color == GxEPD_WHITE) {
+    _buffer[i] |= (1 << (7 - x % 8));
+  } else {
+    _buffer[i] &= ~(1 << (7 - x % 8));
+  }
+}
+
+void WatchyDisplay::fillScreen(uint16_t color) {
+  uint8_t data = (color == GxEPD_BLACK) ? 0x00 : 0xFF;
+  if (_pw_w == WIDTH && _pw_h == HEIGHT) {
+    memset(_buffer, data, sizeof(_buffer));
+    return;
+  }
+  for (int16_t y = _pw_y; y < _pw_y + _pw_h; y++) {
+    memset(&_buffer[_pw_x / 8 + y * WIDTH_BYTES], data, _pw_w / 8);
+  }
+}
+
+void WatchyDisplay::drawBitmap(int16_t x, int16_t y, const uint8_t bitmap[],
+                               int16_t w, int16_t h, uint16_t color) {
+  if (!fastBlit || getRotation() != 0) {
+    Adafruit_GFX::drawBitmap(x, y, bitmap, w, h, color);
+    return;
+  }
+  _blit(x, y, bitmap, w, h, color, 0, false);
+}
+
+void WatchyDisplay::drawBitmap(int16_t x, int16_t y, const uint8_t bitmap[],
+                               int16_t w, int16_t h, uint16_t color,
+                               uint16_t bg) {
+  if (!fastBlit || getRotation() != 0) {
+    Adafruit_GFX::drawBitmap(x, y, bitmap, w, h, color, bg);
+    return;
+  }
+  _blit(x, y, bitmap, w, h, color, bg, true);
+}
+
+void WatchyDisplay::drawBitmap(int16_t x, int16_t y, uint8_t *bitmap,
+                               int16_t w, int16_t h, uint16_t color) {
+  drawBitmap(x, y, (const uint8_t *)bitmap, w, h, color);
+}
+
+void WatchyDisplay::drawBitmap(int16_t x, int16_t y, uint8_t *bitmap,
+                               int16_t w, int16_t h, uint16_t color,
+                               uint16_t bg) {
+  drawBitmap(x, y, (const uint8_t *)bitmap, w, h, color, bg);
+}
+
+// Prints text at the cursor in the text color, like print() with the
+// GFXfont the atlas was generated from (text size 1). Characters outside
+// the atlas are skipped.
+void WatchyDisplay::printAtlas(const WatchyGlyphAtlas *atlas,
+                               const char *text) {
+  for (; *text; text++) {
+    uint8_t c = *text;
+    if (c == '\n') {
+      cursor_x = 0;
+      cursor_y += atlas->yAdvance;
+      continue;
+    }
+    if (c < atlas->first || c > atlas->last) {
+      continue;
+    }
+    const WatchyAtlasGlyph &glyph = atlas->glyph[c - atlas->first];
+    if (glyph.width > 0 && glyph.height > 0) {
+      if (wrap && cursor_x + glyph.xOffset + glyph.width > _width) {
+        cursor_x = 0;
+        cursor_y += atlas->yAdvance;
+      }
+      drawBitmap(cursor_x + glyph.xOffset, cursor_y + glyph.yOffset,
+                 &atlas->bitmap[glyph.bitmapOffset], glyph.width,
+                 glyph.height, textcolor);
+    }
+    cursor_x += glyph.xAdvance;
+  }
+}
+
+// Same result as getTextBounds() with the source GFXfont, from the glyph
+// metrics alone.
+void WatchyDisplay::getAtlasTextBounds(const WatchyGlyphAtlas *atlas,
+                                       const char *text, int16_t x, int16_t y,
+                                       int16_t *x1, int16_t *y1, uint16_t *w,
+                                       uint16_t *h) {
+  int16_t minx = _width, miny = _height, maxx = -1, maxy = -1;
+  *x1          = x;
+  *y1          = y;
+  for (; *text; text++) {
+    uint8_t c = *text;
+    if (c == '\n') {
+      x = 0;
+      y += atlas->yAdvance;
+      continue;
+    }
+    if (c < atlas->first || c > atlas->last) {
+      continue;
+    }
+    const WatchyAtlasGlyph &glyph = atlas->glyph[c - atlas->first];
+    if (wrap && x + glyph.xOffset + glyph.width > _width) {
+      x = 0;
+      y += atlas->yAdvance;
+    }
+    int16_t gx = x + glyph.xOffset, gy = y + glyph.yOffset;
+    minx       = min(minx, gx);
+    miny       = min(miny, gy);
+    maxx       = max(maxx, (int16_t)(gx + glyph.width - 1));
+    maxy       = max(maxy, (int16_t)(gy + glyph.height - 1));
+    x          += glyph.xAdvance;
+  }
+  *w = *h = 0;
+  if (maxx >= minx) {
+    *x1 = minx;
+    *w  = maxx - minx + 1;
+  }
+  if (maxy >= miny) {
+    *y1 = miny;
+    *h  = maxy - miny + 1;
+  }
+}
+
+void WatchyDisplay::setFullWindow() {
+  _pw_x = 0;
+  _pw_y = 0;
+  _pw_w = WIDTH;
+  _pw_h = HEIGHT;
+}
+
+void WatchyDisplay::setPartialWindow(int16_t x, int16_t y, int16_t w,
+                                     int16_t h) {
+  _rotate(x, y, w, h);
+  _alignWindow(x, y, w, h);
+  _pw_x = x;
+  _pw_y = y;
+  _pw_w = w;
+  _pw_h = h;
+}
+
+void WatchyDisplay::display(bool partial_update_mode) {
+  if (_pw_w != WIDTH || _pw_h != HEIGHT) {
+    _writeWindow(_pw_x, _pw_y, _pw_w, _pw_h); // always a partial update
+    return;
+  }
+  if (partial_update_mode) {
+    _countPartial(_flippedPixels(0, 0, WIDTH, HEIGHT));
+  } else {
+    partialUpdateCount = 0;
+    partialPixelCount  = 0;
+  }
+  epd2.writeImage(_buffer, 0, 0, WIDTH, HEIGHT);
+  epd2.refresh(partial_update_mode);
+  if (epd2.hasFastPartialUpdate) {
+    epd2.writeImageAgain(_buffer, 0, 0, WIDTH, HEIGHT);
+  }
+  if (!partial_update_mode) {
+    epd2.powerOff();
+  }
+  memcpy(panelFrame, _buffer, sizeof(_buffer));
+  panelFrameValid = true;
+}
+
+void WatchyDisplay::displayWindow(int16_t x, int16_t y, int16_t w, int16_t h) {
+  _rotate(x, y, w, h);
+  _alignWindow(x, y, w, h);
+  _writeWindow(x, y, w, h);
+}
+
+// Diffs the framebuffer against the frame on the panel and only writes the
+// rows that changed, grouped into up to DIFF_MAX_BANDS bands each clipped to
+// its changed columns, followed by a single partial refresh of their
+// bounding box. Nothing is sent when the frame is unchanged, and the whole
+// frame is pushed when the panel content is unknown or the changed area
+// exceeds DIFF_FULL_PERCENT. Returns the number of pixels that flipped.
+uint32_t WatchyDisplay::displayChanges() {
+  if (!panelFrameValid) {
+    setFullWindow();
+    display(true);
+    return (uint32_t)WIDTH * HEIGHT;
+  }
+
+  int16_t bandY[DIFF_MAX_BANDS], bandH[DIFF_MAX_BANDS];
+  int16_t bandX0[DIFF_MAX_BANDS], bandX1[DIFF_MAX_BANDS]; // byte columns
+  uint8_t bands    = 0;
+  uint32_t flipped = 0;
+  int16_t lastRow  = 0;
+  for (int16_t y = 0; y < HEIGHT; y++) {
+    const uint8_t *row  = &_buffer[y * WIDTH_BYTES];
+    const uint8_t *prev = &panelFrame[y * WIDTH_BYTES];
+    if (memcmp(row, prev, WIDTH_BYTES) == 0) {
+      continue;
+    }
+    int16_t first = 0, last = WIDTH_BYTES - 1;
+    while (row[first] == prev[first]) {
+      first++;
+    }
+    while (row[last] == prev[last]) {
+      last--;
+    }
+    for (int16_t i = first; i <= last; i++) {
+      flipped += __builtin_popcount(row[i] ^ prev[i]);
+    }
+    // extend the current band over small gaps, or when out of bands
+    if (bands > 0 &&
+        (y - lastRow <= DIFF_BAND_GAP + 1 || bands == DIFF_MAX_BANDS)) {
+      uint8_t b = bands - 1;
+      bandH[b]  = y - bandY[b] + 1;
+      bandX0[b] = min(bandX0[b], first);
+      bandX1[b] = max(bandX1[b], last);
+    } else {
+      bandY[bands]  = y;
+      bandH[bands]  = 1;
+      bandX0[bands] = first;
+      bandX1[bands] = last;
+      bands++;
+    }
+    lastRow = y;
+  }
+  if (bands == 0) {
+    return 0;
+  }
+
+  int16_t x0 = bandX0[0], x1 = bandX1[0];
+  for (uint8_t b = 1; b < bands; b++) {
+    x0 = min(x0, bandX0[b]);
+    x1 = max(x1, bandX1[b]);
+  }
+  int16_t x = x0 * 8, w = (x1 - x0 + 1) * 8;
+  int16_t y = bandY[0], h = bandY[bands - 1] + bandH[bands - 1] - y;
+  if ((uint32_t)w * h * 100 > (uint32_t)WIDTH * HEIGHT * DIFF_FULL_PERCENT) {
+    setFullWindow();
+    display(true);
+    return flipped;
+  }
+
+  _countPartial(flipped);
+  for (uint8_t b = 0; b < bands; b++) {
+    int16_t bx = bandX0[b] * 8, bw = (bandX1[b] - bandX0[b] + 1) * 8;
+    epd2.writeImagePart(_buffer, bx, bandY[b], WIDTH, HEIGHT, bx, bandY[b], bw,
+                        bandH[b]);
+  }
+  epd2.refresh(x, y, w, h);
+  if (epd2.hasFastPartialUpdate) {
+    for (uint8_t b = 0; b < bands; b++) {
+      int16_t bx = bandX0[b] * 8, bw = (bandX1[b] - bandX0[b] + 1) * 8;
+      epd2.writeImagePartAgain(_buffer, bx, bandY[b], WIDTH, HEIGHT, bx,
+                               bandY[b], bw, bandH[b]);
+    }
+  }
+  memcpy(panelFrame, _buffer, sizeof(_buffer));
+  return flipped;
+}
+
+void WatchyDisplay::powerOff() { epd2.powerOff(); }
+
+void WatchyDisplay::hibernate() { epd2.hibernate(); }
+
+uint8_t *WatchyDisplay::getBuffer() { return _buffer; }
+
+uint32_t WatchyDisplay::checksum() {
+  uint32_t hash = 2166136261UL;
+  for (uint16_t i = 0; i < sizeof(_buffer); i++) {
+    hash ^= _buffer[i];
+    hash *= 16777619UL;
+  }
+  return hash;
+}
+
+void WatchyDisplay::_rotate(int16_t &x, int16_t &y, int16_t &w, int16_t &h) {
+  switch (getRotation()) {
+  case 1:
+    _swap_int16_t(x, y);
+    _swap_int16_t(w, h);
+    x = WIDTH - x - w;
+    break;
+  case 2:
+    x = WIDTH - x - w;
+    y = HEIGHT - y - h;
+    break;
+  case 3:
+    _swap_int16_t(x, y);
+    _swap_int16_t(w, h);
+    y = HEIGHT - y - h;
+    break;
+  }
+}
+
+void WatchyDisplay::_alignWindow(int16_t &x, int16_t &y, int16_t &w,
+                                 int16_t &h) {
+  if (x < 0) {
+    w += x;
+    x = 0;
+  }
+  if (y < 0) {
+    h += y;
+    y = 0;
+  }
+  w = max((int16_t)0, min(w, (int16_t)(WIDTH - x)));
+  h = max((int16_t)0, min(h, (int16_t)(HEIGHT - y)));
+  // controller RAM is addressed in whole bytes along x
+  w += x % 8;
+  x -= x % 8;
+  if (w % 8 > 0) {
+    w += 8 - w % 8;
+  }
+}
+
+// Copies a 1bpp MSB-first bitmap (the Adafruit GFX drawBitmap layout) into
+// the framebuffer a destination byte at a time: each output byte is the
+// previous and current source byte shifted into place through a 16 bit
+// carry, then merged under a mask that clips to the window. Same result as
+// the per-pixel path, without a drawPixel call per pixel.
+void WatchyDisplay::_blit(int16_t x, int16_t y, const uint8_t bitmap[],
+                          int16_t w, int16_t h, uint16_t color, uint16_t bg,
+                          bool opaque) {
+  int16_t x0 = max(x, _pw_x);
+  int16_t x1 = min((int16_t)(x + w), (int16_t)(_pw_x + _pw_w));
+  int16_t y0 = max(y, _pw_y);
+  int16_t y1 = min((int16_t)(y + h), (int16_t)(_pw_y + _pw_h));
+  if (x0 >= x1 || y0 >= y1) {
+    return;
+  }
+  int16_t byteWidth = (w + 7) / 8;
+  uint8_t shift     = x & 7; // bitmap bit 0 lands at this bit of its byte
+  int16_t firstByte = x0 / 8, lastByte = (x1 - 1) / 8;
+  // source byte whose high bits land in firstByte; the one before it
+  // supplies the low bits when the bitmap is not byte aligned
+  int16_t srcStart = firstByte - (x >> 3);
+  uint8_t lastMask = (w & 7) ? (uint8_t)(0xFF << (8 - (w & 7))) : 0xFF;
+  bool white       = (color == GxEPD_WHITE);
+  bool bgWhite     = (bg == GxEPD_WHITE);
+
+  for (int16_t row = y0; row < y1; row++) {
+    const uint8_t *src = &bitmap[(row - y) * byteWidth];
+    uint8_t *dst       = &_buffer[row * WIDTH_BYTES];
+    int16_t s          = srcStart;
+    uint16_t carry     = 0;
+    if (shift && s > 0) {
+      carry = pgm_read_byte(&src[s - 1]) & (s == byteWidth ? lastMask : 0xFF);
+    }
+    for (int16_t d = firstByte; d <= lastByte; d++, s++) {
+      uint8_t next = 0;
+      if (s >= 0 && s < byteWidth) {
+        next = pgm_read_byte(&src[s]) & (s == byteWidth - 1 ? lastMask : 0xFF);
+      }
+      uint8_t bits = ((carry << 8) | next) >> shift;
+      carry        = next;
+
+      uint8_t mask = 0xFF;
+      if (d == firstByte) {
+        mask &= 0xFF >> (x0 & 7);
+      }
+      if (d == lastByte) {
+        mask &= 0xFF << (7 - ((x1 - 1) & 7));
+      }
+      if (opaque) {
+        uint8_t value = (white ? bits : 0) | (bgWhite ? ~bits : 0);
+        dst[d]        = (dst[d] & ~mask) | (value & mask);
+      } else if (white) {
+        dst[d] |= bits & mask;
+      } else {
+        dst[d] &= ~(bits & mask);
+      }
+    }
+  }
+}
+
+void WatchyDisplay::_writeWindow(int16_t x, int16_t y, int16_t w, int16_t h) {
+  if (w == 0 || h == 0) {
+    return;
+  }
+  _countPartial(_flippedPixels(x, y, w, h));
+  epd2.writeImagePart(_buffer, x, y, WIDTH, HEIGHT, x, y, w, h);
+  epd2.refresh(x, y, w, h);
+  if (epd2.hasFastPartialUpdate) {
+    epd2.writeImagePartAgain(_buffer, x, y, WIDTH, HEIGHT, x, y, w, h);
+  }
+  for (int16_t row = y; row < y + h; row++) {
+    uint16_t i = x / 8 + row * WIDTH_BYTES;
+    memcpy(&panelFrame[i], &_buffer[i], w / 8);
+  }
+}
+
+// x and w in panel coordinates, multiples of 8
+uint32_t WatchyDisplay::_flippedPixels(int16_t x, int16_t y, int16_t w,
+                                       int16_t h) {
+  if (!panelFrameValid) {
+    return (uint32_t)w * h;
+  }
+  uint32_t flipped = 0;
+  for (int16_t row = y; row < y + h; row++) {
+    uint16_t i = x / 8 + row * WIDTH_BYTES;
+    for (int16_t b = 0; b < w / 8; b++) {
+      flipped += __builtin_popcount(_buffer[i + b] ^ panelFrame[i + b]);
+    }
+  }
+  return flipped;
+}
+
+void WatchyDisplay::_countPartial(uint32_t flipped) {
+  if (partialUpdateCount < UINT16_MAX) {
+    partialUpdateCount++;
+  }
+  partialPixelCount += flipped;
+}
+
+uint16_t WatchyDisplay::partialUpdates() { return partialUpdateCount; }
+
+uint32_t WatchyDisplay::partialPixels() { return partialPixelCount; }
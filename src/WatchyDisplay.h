@@ -0,0 +1,79 @@
+#ifndef WATCHY_DISPLAY_H
+#define WATCHY_DISPLAY_H
+
+#include <Adafruit_GFX.h>
+#include <GxEPD2_BW.h>
+#include "config.h"
+
+// GFXglyph metrics with the bitmap rows padded to whole bytes, so a glyph
+// is drawn with the drawBitmap blitter instead of bit by bit. Atlases are
+// generated from GFXfont headers by extras/glyph_atlas.py.
+typedef struct {
+  uint16_t bitmapOffset;
+  uint8_t width, height;
+  uint8_t xAdvance;
+  int8_t xOffset, yOffset;
+} WatchyAtlasGlyph;
+
+typedef struct {
+  const uint8_t *bitmap;
+  const WatchyAtlasGlyph *glyph;
+  uint8_t first, last;
+  uint8_t yAdvance;
+} WatchyGlyphAtlas;
+
+// Drop-in replacement for GxEPD2_BW<GxEPD2_154_D67, HEIGHT>. It keeps the
+// whole 200x200 frame in a single page so the library can read it back
+// (checksums, diffing, layer caching) instead of treating it as write-only.
+class WatchyDisplay : public Adafruit_GFX {
+public:
+  static const uint16_t WIDTH_BYTES = GxEPD2_154_D67::WIDTH / 8;
+  static const uint16_t BUFFER_SIZE = WIDTH_BYTES * GxEPD2_154_D67::HEIGHT;
+  GxEPD2_154_D67 epd2;
+  bool fastBlit = true; // false falls back to Adafruit GFX per-pixel drawing
+
+public:
+  explicit WatchyDisplay(GxEPD2_154_D67 epd2_instance);
+  void init(uint32_t serial_diag_bitrate = 0);
+  void init(uint32_t serial_diag_bitrate, bool initial,
+            uint16_t reset_duration = 10, bool pulldown_rst_mode = false);
+  void drawPixel(int16_t x, int16_t y, uint16_t color);
+  void fillScreen(uint16_t color);
+  using Adafruit_GFX::drawBitmap;
+  void drawBitmap(int16_t x, int16_t y, const uint8_t bitmap[], int16_t w,
+                  int16_t h, uint16_t color);
+  void drawBitmap(int16_t x, int16_t y, const uint8_t bitmap[], int16_t w,
+                  int16_t h, uint16_t color, uint16_t bg);
+  void drawBitmap(int16_t x, int16_t y, uint8_t *bitmap, int16_t w, int16_t h,
+                  uint16_t color);
+  void drawBitmap(int16_t x, int16_t y, uint8_t *bitmap, int16_t w, int16_t h,
+                  uint16_t color, uint16_t bg);
+  void printAtlas(const WatchyGlyphAtlas *atlas, const char *text);
+  void getAtlasTextBounds(const WatchyGlyphAtlas *atlas, const char *text,
+                          int16_t x, int16_t y, int16_t *x1, int16_t *y1,
+                          uint16_t *w, uint16_t *h);
+  void setFullWindow();
+  void setPartialWindow(int16_t x, int16_t y, int16_t w, int16_t h);
+  void display(bool partial_update_mode = false);
+  void displayWindow(int16_t x, int16_t y, int16_t w, int16_t h);
+  uint32_t displayChanges(); // partial update of what changed, see .cpp
+  uint16_t partialUpdates(); // since the last full refresh
+  uint32_t partialPixels();  // pixels flipped by those partial updates
+  void powerOff();
+  void hibernate();
+  uint8_t *getBuffer();
+  uint32_t checksum(); // FNV-1a over the framebuffer
+
+private:
+  uint8_t _buffer[BUFFER_SIZE]; // 1bpp, MSB first, 1 = white
+  int16_t _pw_x, _pw_y, _pw_w, _pw_h; // current window, panel coordinates
+  void _rotate(int16_t &x, int16_t &y, int16_t &w, int16_t &h);
+  void _alignWindow(int16_t &x, int16_t &y, int16_t &w, int16_t &h);
+  void _writeWindow(int16_t x, int16_t y, int16_t w, int16_t h);
+  uint32_t _flippedPixels(int16_t x, int16_t y, int16_t w, int16_t h);
+  void _countPartial(uint32_t flipped);
+  void _blit(int16_t x, int16_t y, const uint8_t bitmap[], int16_t w,
+             int16_t h, uint16_t color, uint16_t bg, bool opaque);
+};
+
+#endif
@@ -0,0 +1,82 @@
+#include "WatchyHTTPCache.h"
+
+bool WatchyHTTPCache::load(const char *key, const char *url,
+                           httpCacheEntry &entry) {
+  Preferences prefs;
+  size_t stored = 0;
+  if (prefs.begin("http", true)) {
+    stored = prefs.getBytes(key, &entry, sizeof(entry));
+    prefs.end();
+  }
+  uint32_t hash = _hash(url);
+  if (stored != sizeof(entry) || entry.url != hash) {
+    memset(&entry, 0, sizeof(entry));
+    entry.url = hash;
+    return false;
+  }
+  return true;
+}
+
+int WatchyHTTPCache::get(HTTPClient &http, httpCacheEntry &entry,
+                         time_t now) {
+  const char *headers[] = {"ETag", "Last-Modified", "Cache-Control"};
+  http.collectHeaders(headers, 3);
+  if (entry.etag[0] != '\0') {
+    http.addHeader("If-None-Match", entry.etag);
+  }
+  if (entry.lastModified[0] != '\0') {
+    http.addHeader("If-Modified-Since", entry.lastModified);
+  }
+  int code = http.GET();
+  if (code != HTTP_CODE_OK && code != HTTP_CODE_NOT_MODIFIED) {
+    return code;
+  }
+  // a 304 repeats the validators, or leaves them out if they still hold
+  if (code == HTTP_CODE_OK || http.hasHeader("ETag")) {
+    _copyHeader(http, "ETag", entry.etag, sizeof(entry.etag));
+  }
+  if (code == HTTP_CODE_OK || http.hasHeader("Last-Modified")) {
+    _copyHeader(http, "Last-Modified", entry.lastModified,
+                sizeof(entry.lastModified));
+  }
+  String cacheControl = http.header("Cache-Control");
+  const char *maxAge  = strstr(cacheControl.c_str(), "max-age=");
+  entry.maxAge        = maxAge != NULL ? strtoul(maxAge + 8, NULL, 10) : 0;
+  entry.fetched = now; // a 304 confirms the data as of now
+  return code;
+}
+
+void WatchyHTTPCache::store(const char *key, const httpCacheEntry &entry) {
+  Preferences prefs;
+  prefs.begin("http", false);
+  prefs.putBytes(key, &entry, sizeof(entry));
+  prefs.end();
+}
+
+void WatchyHTTPCache::clear() {
+  Preferences prefs;
+  prefs.begin("http", false);
+  prefs.clear();
+  prefs.end();
+}
+
+// FNV-1a
+uint32_t WatchyHTTPCache::_hash(const char *text) {
+  uint32_t hash = 2166136261UL;
+  for (; *text != '\0'; text++) {
+    hash = (hash ^ (uint8_t)*text) * 16777619UL;
+  }
+  return hash;
+}
+
+// An empty value if the header is missing or too long to keep whole, a cut
+// validator would never match
+void WatchyHTTPCache::_copyHeader(HTTPClient &http, const char *name,
+                                  char *value, size_t size) {
+  String header = http.header(name);
+  if (header.length() < size) {
+    strcpy(value, header.c_str());
+  } else {
+    value[0] = '\0';
+  }
+}
@@ -0,0 +1,45 @@
+#ifndef WATCHY_HTTP_CACHE_H
+#define WATCHY_HTTP_CACHE_H
+
+#include <Arduino.h>
+#include <HTTPClient.h>
+#include <Preferences.h>
+
+#define HTTP_CACHE_ETAG 48 // longer ETags are not kept
+#define HTTP_CACHE_DATE 32 // an HTTP date is 29 characters
+#define HTTP_CACHE_DATA 32
+
+// The validators of one response and what the caller parsed out of it,
+// kept in NVS so a reset does not cost a full fetch
+typedef struct httpCacheEntry {
+  uint32_t url;     // hash of the request URL, a new query is a miss
+  uint32_t fetched; // time of the last 200 or 304, in the RTC's clock
+  uint32_t maxAge;  // seconds, from Cache-Control, 0 if not given
+  char etag[HTTP_CACHE_ETAG];
+  char lastModified[HTTP_CACHE_DATE];
+  uint8_t length; // of data
+  uint8_t data[HTTP_CACHE_DATA];
+} httpCacheEntry;
+
+// Conditional GETs. A 304 carries no body, so the radio is on for a few
+// hundred bytes of headers instead of the whole response.
+class WatchyHTTPCache {
+public:
+  // Returns false, with an empty entry for url, if key holds nothing for
+  // that URL
+  static bool load(const char *key, const char *url, httpCacheEntry &entry);
+  // GET with If-None-Match and If-Modified-Since from the entry, which
+  // takes the new validators, max-age and fetch time. On a 200, read the
+  // body, fill in data and store() the entry. On a 304 only the fetch time
+  // changed, so storing it can wait.
+  static int get(HTTPClient &http, httpCacheEntry &entry, time_t now);
+  static void store(const char *key, const httpCacheEntry &entry);
+  static void clear();
+
+private:
+  static uint32_t _hash(const char *text);
+  static void _copyHeader(HTTPClient &http, const char *name, char *value,
+                          size_t size);
+};
+
+#endif
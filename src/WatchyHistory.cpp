@@ -0,0 +1,217 @@
+#include "WatchyHistory.h"
+
+// Record formats, by the first byte:
+//   0sssssss        s steps, battery and temperature unchanged
+//   10gggggg        g + 1 intervals without a record (watch was off or busy)
+//   110000bt ...    varint steps, then zigzag varint deltas of the battery
+//                   (if b) and the temperature (if t)
+#define HISTORY_GAP     0x80
+#define HISTORY_FULL    0xC0
+#define HISTORY_BATTERY 0x02
+#define HISTORY_TEMP    0x01
+#define HISTORY_MAX_GAP 256 // intervals, a longer gap starts a new page
+
+RTC_DATA_ATTR historyPage historyRtcPage;
+RTC_DATA_ATTR uint32_t historyNext;    // time of the next record, 0 if none
+RTC_DATA_ATTR uint32_t historySteps;   // step counter at the last record
+RTC_DATA_ATTR uint16_t historyBattery; // as last recorded, 10 mV units
+RTC_DATA_ATTR int8_t historyTemperature;
+
+bool WatchyHistory::due(time_t now) {
+  // also true if the clock was set back past the last record
+  return historyNext == 0 || now >= historyNext ||
+         now < historyNext - HISTORY_INTERVAL * 60;
+}
+
+void WatchyHistory::append(time_t now, uint32_t stepCounter,
+                           float batteryVoltage, float temperature) {
+  const uint32_t interval = HISTORY_INTERVAL * 60;
+  uint32_t slot           = now - now % interval;
+  // the counter restarts at midnight in some faces and on a sensor re-init
+  uint32_t steps =
+      stepCounter >= historySteps ? stepCounter - historySteps : stepCounter;
+  historySteps = stepCounter;
+
+  // small changes are ADC noise, a record per change would triple the size
+  uint16_t battery = lroundf(batteryVoltage * 100);
+  uint8_t flags    = 0;
+  if (abs(battery - historyBattery) >= HISTORY_BATTERY_STEP) {
+    flags |= HISTORY_BATTERY;
+  }
+  if (fabsf(temperature - historyTemperature) >= 1.0f) {
+    flags |= HISTORY_TEMP;
+  }
+  uint8_t record[12];
+  uint8_t length = 0;
+  if (flags == 0 && steps < HISTORY_GAP) {
+    record[length++] = steps;
+  } else {
+    record[length++] = HISTORY_FULL | flags;
+    length += _putVarint(record + length, steps);
+    if (flags & HISTORY_BATTERY) {
+      length += _putVarint(record + length, _zigzag(battery - historyBattery));
+    }
+    if (flags & HISTORY_TEMP) {
+      int8_t degrees = lroundf(temperature);
+      length +=
+          _putVarint(record + length, _zigzag(degrees - historyTemperature));
+    }
+  }
+
+  uint32_t missed = slot >= historyNext ? (slot - historyNext) / interval : 0;
+  if (historyNext == 0 || slot < historyNext || missed > HISTORY_MAX_GAP) {
+    _newPage(slot);
+    missed = 0;
+  }
+  uint8_t gaps = (missed + 63) / 64;
+  if (historyRtcPage.length + gaps + length >
+      (int)sizeof(historyRtcPage.data)) {
+    _newPage(slot);
+    missed = 0;
+  }
+  for (; missed > 0; missed -= min(missed, (uint32_t)64)) {
+    historyRtcPage.data[historyRtcPage.length++] =
+        HISTORY_GAP | (min(missed, (uint32_t)64) - 1);
+  }
+  memcpy(historyRtcPage.data + historyRtcPage.length, record, length);
+  historyRtcPage.length += length;
+  historyNext = slot + interval;
+  // the page base holds the values before its first record, so only update
+  // them once the record is in
+  if (flags & HISTORY_BATTERY) {
+    historyBattery = battery;
+  }
+  if (flags & HISTORY_TEMP) {
+    historyTemperature = lroundf(temperature);
+  }
+}
+
+uint16_t WatchyHistory::query(time_t from, uint32_t bucketSeconds,
+                              historyBucket *buckets, uint16_t count) {
+  memset(buckets, 0, count * sizeof(historyBucket));
+  uint16_t found = 0;
+  Preferences prefs;
+  if (prefs.begin("history", true)) {
+    uint8_t head = prefs.getUChar("head", 0);
+    historyPage page;
+    char key[8];
+    // head is the oldest page, the next one to be overwritten
+    for (uint8_t i = 0; i < HISTORY_PAGES; i++) {
+      snprintf(key, sizeof(key), "p%u", (head + i) % HISTORY_PAGES);
+      size_t stored = prefs.getBytes(key, &page, sizeof(page));
+      if (stored < offsetof(historyPage, data) ||
+          page.length > stored - offsetof(historyPage, data)) {
+        continue;
+      }
+      found += _decode(page, from, bucketSeconds, buckets, count);
+    }
+    prefs.end();
+  }
+  return found + _decode(historyRtcPage, from, bucketSeconds, buckets, count);
+}
+
+void WatchyHistory::flush() {
+  if (historyRtcPage.length > 0) {
+    _newPage(historyNext);
+  }
+}
+
+void WatchyHistory::clear() {
+  Preferences prefs;
+  prefs.begin("history", false);
+  prefs.clear();
+  prefs.end();
+  historyRtcPage.length = 0;
+  historyNext           = 0;
+}
+
+void WatchyHistory::_newPage(uint32_t start) {
+  if (historyRtcPage.length > 0) {
+    _spill();
+  }
+  historyRtcPage.start       = start;
+  historyRtcPage.length      = 0;
+  historyRtcPage.battery     = historyBattery;
+  historyRtcPage.temperature = historyTemperature;
+  historyRtcPage.interval    = HISTORY_INTERVAL;
+}
+
+// Once per page, so NVS sees a write every few hours at most
+void WatchyHistory::_spill() {
+  Preferences prefs;
+  prefs.begin("history", false);
+  uint8_t head = prefs.getUChar("head", 0);
+  char key[8];
+  snprintf(key, sizeof(key), "p%u", head);
+  prefs.putBytes(key, &historyRtcPage,
+                 offsetof(historyPage, data) + historyRtcPage.length);
+  prefs.putUChar("head", (head + 1) % HISTORY_PAGES);
+  prefs.end();
+}
+
+uint16_t WatchyHistory::_decode(const historyPage &page, time_t from,
+                                uint32_t bucketSeconds, historyBucket *buckets,
+                                uint16_t count) {
+  const uint32_t interval = page.interval * 60;
+  uint32_t time           = page.start;
+  uint16_t battery        = page.battery;
+  int8_t temperature      = page.temperature;
+  uint16_t found          = 0;
+  for (uint16_t i = 0; i < page.length;) {
+    uint8_t tag    = page.data[i++];
+    uint32_t steps = tag;
+    if ((tag & HISTORY_FULL) == HISTORY_GAP) {
+      time += ((tag & 0x3F) + 1) * interval;
+      continue;
+    }
+    if (tag & HISTORY_GAP) {
+      steps = _getVarint(page.data, i, page.length);
+      if (tag & HISTORY_BATTERY) {
+        battery += _unzigzag(_getVarint(page.data, i, page.length));
+      }
+      if (tag & HISTORY_TEMP) {
+        temperature += _unzigzag(_getVarint(page.data, i, page.length));
+      }
+    }
+    if (time >= from && (time - from) / bucketSeconds < count) {
+      historyBucket &bucket = buckets[(time - from) / bucketSeconds];
+      bucket.steps += steps;
+      bucket.battery     = battery * 10;
+      bucket.temperature = temperature;
+      bucket.records++;
+      found++;
+    }
+    time += interval;
+  }
+  return found;
+}
+
+uint8_t WatchyHistory::_putVarint(uint8_t *data, uint32_t value) {
+  uint8_t length = 0;
+  for (; value >= 0x80; value >>= 7) {
+    data[length++] = value | 0x80;
+  }
+  data[length++] = value;
+  return length;
+}
+
+uint32_t WatchyHistory::_getVarint(const uint8_t *data, uint16_t &i,
+                                   uint16_t length) {
+  uint32_t value = 0;
+  for (uint8_t shift = 0; i < length && shift < 32; shift += 7) {
+    uint8_t b = data[i++];
+    value |= (uint32_t)(b & 0x7F) << shift;
+    if (!(b & 0x80)) {
+      break;
+    }
+  }
+  return value;
+}
+
+uint32_t WatchyHistory::_zigzag(int32_t value) {
+  return ((uint32_t)value << 1) ^ (value >> 31);
+}
+
+int32_t WatchyHistory::_unzigzag(uint32_t value) {
+  return (value >> 1) ^ -(int32_t)(value & 1);
+}
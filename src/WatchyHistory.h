@@ -0,0 +1,54 @@
+#ifndef WATCHY_HISTORY_H
+#define WATCHY_HISTORY_H
+
+#include <Arduino.h>
+#include <Preferences.h>
+#include "config.h"
+
+// One page of records. The page being filled lives in RTC memory, full pages
+// are spilled to a ring of HISTORY_PAGES blobs in NVS. Records are delta
+// encoded against the previous one (see WatchyHistory.cpp), so a quiet
+// interval costs a single byte.
+typedef struct historyPage {
+  uint32_t start;     // time of the first record
+  uint16_t length;    // bytes used in data
+  uint16_t battery;   // value before the first record, 10 mV units
+  int8_t temperature; // value before the first record, degrees C
+  uint8_t interval;   // minutes per record
+  uint8_t data[HISTORY_PAGE_SIZE - 10];
+} historyPage;
+
+typedef struct historyBucket {
+  uint32_t steps;     // steps taken during the bucket
+  uint16_t battery;   // last battery voltage seen, mV
+  int8_t temperature; // last temperature seen, degrees C
+  uint16_t records;   // 0 if the watch logged nothing in the bucket
+} historyBucket;
+
+// Steps, battery voltage and temperature, one record every HISTORY_INTERVAL
+// minutes. Times are seconds in the RTC's clock (makeTime(currentTime)).
+class WatchyHistory {
+public:
+  static bool due(time_t now); // a record is due for this tick
+  static void append(time_t now, uint32_t stepCounter, float batteryVoltage,
+                     float temperature);
+  // Splits [from, from + count * bucketSeconds) into count buckets, e.g. 24
+  // hours or 7 days. Returns the number of records found.
+  static uint16_t query(time_t from, uint32_t bucketSeconds,
+                        historyBucket *buckets, uint16_t count);
+  static void flush(); // spill the RTC page now, e.g. before an update
+  static void clear();
+
+private:
+  static void _newPage(uint32_t start);
+  static void _spill();
+  static uint16_t _decode(const historyPage &page, time_t from,
+                          uint32_t bucketSeconds, historyBucket *buckets,
+                          uint16_t count);
+  static uint8_t _putVarint(uint8_t *data, uint32_t value);
+  static uint32_t _getVarint(const uint8_t *data, uint16_t &i, uint16_t length);
+  static uint32_t _zigzag(int32_t value);
+  static int32_t _unzigzag(uint32_t value);
+};
+
+#endif
@@ -0,0 +1,54 @@
+#include "WatchyI2C.h"
+
+uint16_t WatchyI2C::read(uint8_t address, uint8_t reg, uint8_t *data,
+                         uint16_t len) {
+  return _read(address, reg, data, len, true);
+}
+
+uint16_t WatchyI2C::readPort(uint8_t address, uint8_t reg, uint8_t *data,
+                             uint16_t len) {
+  return _read(address, reg, data, len, false);
+}
+
+uint16_t WatchyI2C::write(uint8_t address, uint8_t reg, uint8_t *data,
+                          uint16_t len) {
+  // one byte of every chunk goes to the register address
+  const uint16_t chunk = I2C_BUFFER_LENGTH - 1;
+  uint16_t done        = 0;
+  do {
+    uint16_t n = min((uint16_t)(len - done), chunk);
+    Wire.beginTransmission(address);
+    Wire.write(reg + done);
+    Wire.write(data + done, n);
+    uint8_t error = Wire.endTransmission();
+    if (error != I2C_OK) {
+      return error;
+    }
+    done += n;
+  } while (done < len);
+  return I2C_OK;
+}
+
+uint16_t WatchyI2C::probe(uint8_t address) {
+  Wire.beginTransmission(address);
+  return Wire.endTransmission();
+}
+
+uint16_t WatchyI2C::_read(uint8_t address, uint8_t reg, uint8_t *data,
+                          uint16_t len, bool increment) {
+  for (uint16_t done = 0; done < len;) {
+    uint8_t n = min(len - done, I2C_BUFFER_LENGTH);
+    Wire.beginTransmission(address);
+    Wire.write(increment ? reg + done : reg);
+    uint8_t error = Wire.endTransmission(false); // repeated start
+    if (error != I2C_OK) {
+      return error;
+    }
+    if (Wire.requestFrom(address, n) != n) {
+      return I2C_SHORT_READ;
+    }
+    Wire.readBytes(data + done, n);
+    done += n;
+  }
+  return I2C_OK;
+}
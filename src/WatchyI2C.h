@@ -0,0 +1,43 @@
+#ifndef WATCHY_I2C_H
+#define WATCHY_I2C_H
+
+#include <Arduino.h>
+#include <Wire.h>
+
+#ifndef I2C_BUFFER_LENGTH
+#define I2C_BUFFER_LENGTH 128
+#endif
+
+// 1-5 are the codes of Wire.endTransmission()
+enum i2cResult {
+  I2C_OK = 0,
+  I2C_TOO_LONG,   // does not fit the Wire buffer
+  I2C_ADDR_NACK,  // no device at the address
+  I2C_DATA_NACK,  // device rejected a byte
+  I2C_BUS_ERROR,  // arbitration lost, bus stuck, ...
+  I2C_TIMEOUT,    // clock stretched for too long
+  I2C_SHORT_READ, // device sent fewer bytes than requested
+};
+
+// Register access shared by the BMA423 and RTC drivers. Reads address the
+// register and turn the bus around with a repeated start, then copy the
+// reply out of the Wire buffer in one go. Transfers longer than the Wire
+// buffer are split, continuing at the next register. The read and write
+// signatures match bma4_com_fptr_t.
+class WatchyI2C {
+public:
+  static uint16_t read(uint8_t address, uint8_t reg, uint8_t *data,
+                       uint16_t len);
+  // for data ports such as a FIFO, where every chunk reads the same register
+  static uint16_t readPort(uint8_t address, uint8_t reg, uint8_t *data,
+                           uint16_t len);
+  static uint16_t write(uint8_t address, uint8_t reg, uint8_t *data,
+                        uint16_t len);
+  static uint16_t probe(uint8_t address);
+
+private:
+  static uint16_t _read(uint8_t address, uint8_t reg, uint8_t *data,
+                        uint16_t len, bool increment);
+};
+
+#endif
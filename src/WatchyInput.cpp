@@ -0,0 +1,85 @@
+#include "WatchyInput.h"
+
+static const uint8_t buttonPins[] = {MENU_BTN_PIN, BACK_BTN_PIN, UP_BTN_PIN,
+                                     DOWN_BTN_PIN}; // in buttonEvent order
+
+uint8_t WatchyInput::_held;
+uint32_t WatchyInput::_repeatAt;
+
+void WatchyInput::begin() {
+  for (uint8_t i = 0; i < sizeof(buttonPins); i++) {
+    pinMode(buttonPins[i], INPUT);
+  }
+  _held     = _pressed();
+  _repeatAt = millis() + INPUT_REPEAT_DELAY_MS;
+}
+
+uint8_t WatchyInput::wait(uint32_t timeoutMs) {
+  uint32_t start = millis();
+  while (true) {
+    uint32_t now     = millis();
+    uint32_t elapsed = now - start;
+    if (_held != BUTTON_NONE) {
+      if (digitalRead(buttonPins[_held - 1]) == LOW) {
+        _held = BUTTON_NONE;
+        _sleep(INPUT_DEBOUNCE_MS); // let the contact settle
+        continue;
+      }
+      bool repeats = _held == BUTTON_UP || _held == BUTTON_DOWN;
+      if (repeats && (int32_t)(now - _repeatAt) >= 0) {
+        _repeatAt = now + INPUT_REPEAT_MS;
+        return _held;
+      }
+    } else {
+      uint8_t event = _pressed();
+      if (event != BUTTON_NONE) {
+        _sleep(INPUT_DEBOUNCE_MS);
+        if (digitalRead(buttonPins[event - 1]) == HIGH) {
+          _held     = event;
+          _repeatAt = millis() + INPUT_REPEAT_DELAY_MS;
+          return event;
+        }
+        continue; // bounce
+      }
+    }
+    if (elapsed >= timeoutMs) {
+      return BUTTON_NONE;
+    }
+    uint32_t ms = timeoutMs - elapsed;
+    if (_held == BUTTON_UP || _held == BUTTON_DOWN) {
+      ms = min(ms, _repeatAt - now);
+    }
+    _sleep(ms);
+  }
+}
+
+uint8_t WatchyInput::_pressed() {
+  for (uint8_t i = 0; i < sizeof(buttonPins); i++) {
+    if (digitalRead(buttonPins[i]) == HIGH) {
+      return i + 1;
+    }
+  }
+  return BUTTON_NONE;
+}
+
+// Light sleep for up to ms. Wakes when a button goes down, or when the held
+// one is released. All wake sources are disarmed again afterwards, so the
+// display busy callback and deep sleep only see their own.
+void WatchyInput::_sleep(uint32_t ms) {
+  gpio_wakeup_disable((gpio_num_t)DISPLAY_BUSY); // armed by the busy callback
+  if (_held != BUTTON_NONE) {
+    gpio_wakeup_enable((gpio_num_t)buttonPins[_held - 1], GPIO_INTR_LOW_LEVEL);
+  } else {
+    for (uint8_t i = 0; i < sizeof(buttonPins); i++) {
+      gpio_wakeup_enable((gpio_num_t)buttonPins[i], GPIO_INTR_HIGH_LEVEL);
+    }
+  }
+  esp_sleep_enable_gpio_wakeup();
+  esp_sleep_enable_timer_wakeup((uint64_t)ms * 1000);
+  esp_light_sleep_start();
+  for (uint8_t i = 0; i < sizeof(buttonPins); i++) {
+    gpio_wakeup_disable((gpio_num_t)buttonPins[i]);
+  }
+  esp_sleep_disable_wakeup_source(ESP_SLEEP_WAKEUP_TIMER);
+  esp_sleep_disable_wakeup_source(ESP_SLEEP_WAKEUP_GPIO);
+}
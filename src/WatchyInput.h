@@ -0,0 +1,31 @@
+#ifndef WATCHY_INPUT_H
+#define WATCHY_INPUT_H
+
+#include <Arduino.h>
+#include "config.h"
+
+enum buttonEvent {
+  BUTTON_NONE = 0, // wait() timed out
+  BUTTON_MENU,
+  BUTTON_BACK,
+  BUTTON_UP,
+  BUTTON_DOWN
+};
+
+// Button events for screens that stay awake between presses. The CPU light
+// sleeps until a button goes down (or comes back up, or the timeout runs
+// out) instead of polling, presses are debounced, and holding UP or DOWN
+// repeats.
+class WatchyInput {
+public:
+  static void begin(); // a button held from the wake press only repeats
+  static uint8_t wait(uint32_t timeoutMs); // next event, BUTTON_NONE on timeout
+
+private:
+  static uint8_t _held; // event of the button being held, or BUTTON_NONE
+  static uint32_t _repeatAt;
+  static uint8_t _pressed();
+  static void _sleep(uint32_t ms);
+};
+
+#endif
@@ -0,0 +1,200 @@
+#include "WatchyJSON.h"
+
+WatchyJSON::WatchyJSON(const char *const *paths, uint8_t count) {
+  _paths       = paths;
+  _count       = min(count, (uint8_t)JSON_MAX_FIELDS);
+  _found       = 0;
+  _state       = JSON_VALUE;
+  _inKey       = false;
+  _escape      = false;
+  _overflow    = false;
+  _capture     = -1;
+  _valueLength = 0;
+  _depth       = 0;
+  _length      = 0;
+  _path[0]     = '\0';
+  memset(_values, 0, sizeof(_values));
+}
+
+void WatchyJSON::feed(char c) {
+  if (_state == JSON_STRING) {
+    if (_escape) {
+      _escape = false;
+      _put(c);
+    } else if (c == '\\') {
+      _escape = true;
+    } else if (c != '"') {
+      _put(c);
+    } else if (_inKey) {
+      _inKey = false;
+      _state = JSON_COLON;
+    } else {
+      _endValue();
+    }
+    return;
+  }
+  if (_state == JSON_LITERAL) {
+    if (c != ',' && c != '}' && c != ']' && !isspace(c)) {
+      _put(c);
+      return;
+    }
+    _endValue(); // and handle c below
+  }
+  if (isspace(c)) {
+    return;
+  }
+  switch (_state) {
+  case JSON_VALUE:
+    if (c == ']' && _depth > 0 && _stack[_depth - 1] == '[' &&
+        _index[_depth - 1] == 0) {
+      _close(c);
+      break;
+    }
+    _beginValue();
+    if (c == '{' || c == '[') {
+      _capture = -1; // containers are not values here
+      _open(c);
+    } else if (c == '"') {
+      _state = JSON_STRING;
+    } else {
+      _state = JSON_LITERAL;
+      _put(c);
+    }
+    break;
+  case JSON_KEY:
+    if (c == '"') {
+      _length = _prefix[_depth - 1];
+      _overflow = false;
+      if (_length > 0) {
+        _append(".");
+      }
+      _inKey = true;
+      _state = JSON_STRING;
+    } else if (c == '}') {
+      _close(c);
+    } else {
+      _state = JSON_ERROR;
+    }
+    break;
+  case JSON_COLON:
+    _state = c == ':' ? JSON_VALUE : JSON_ERROR;
+    break;
+  case JSON_NEXT:
+    if (c == ',') {
+      if (_stack[_depth - 1] == '{') {
+        _state = JSON_KEY;
+      } else {
+        _index[_depth - 1]++;
+        _state = JSON_VALUE;
+      }
+    } else {
+      _close(c);
+    }
+    break;
+  default: // JSON_END, JSON_ERROR
+    break;
+  }
+}
+
+bool WatchyJSON::parse(Stream &stream) {
+  uint8_t chunk[64];
+  while (!done()) {
+    // whatever is buffered, or wait up to the stream timeout for one byte
+    size_t n = stream.readBytes(
+        chunk, constrain(stream.available(), 1, (int)sizeof(chunk)));
+    if (n == 0) {
+      break;
+    }
+    for (size_t i = 0; i < n && !done(); i++) {
+      feed(chunk[i]);
+    }
+  }
+  return complete();
+}
+
+bool WatchyJSON::done() {
+  return complete() || _state == JSON_END || _state == JSON_ERROR;
+}
+
+bool WatchyJSON::found(uint8_t field) { return _found & (1 << field); }
+
+bool WatchyJSON::complete() { return _found == (1 << _count) - 1; }
+
+const char *WatchyJSON::value(uint8_t field) {
+  return field < _count ? _values[field] : "";
+}
+
+long WatchyJSON::toInt(uint8_t field) { return strtol(value(field), NULL, 10); }
+
+float WatchyJSON::toFloat(uint8_t field) { return strtof(value(field), NULL); }
+
+void WatchyJSON::_put(char c) {
+  if (_inKey) {
+    char text[2] = {c, '\0'};
+    _append(text);
+  } else if (_capture >= 0 && _valueLength < JSON_VALUE_LENGTH - 1) {
+    _values[_capture][_valueLength++] = c;
+    _values[_capture][_valueLength]   = '\0';
+  }
+}
+
+void WatchyJSON::_append(const char *text) {
+  for (; *text != '\0'; text++) {
+    if (_length >= JSON_PATH_LENGTH - 1) {
+      _overflow = true;
+      return;
+    }
+    _path[_length++] = *text;
+  }
+  _path[_length] = '\0';
+}
+
+// Names array elements and picks the field the value belongs to, if any
+void WatchyJSON::_beginValue() {
+  if (_depth > 0 && _stack[_depth - 1] == '[') {
+    char index[8];
+    snprintf(index, sizeof(index), "[%u]", _index[_depth - 1]);
+    _length   = _prefix[_depth - 1];
+    _overflow = false;
+    _append(index);
+  }
+  _capture     = -1;
+  _valueLength = 0;
+  for (uint8_t i = 0; i < _count && !_overflow; i++) {
+    if (!found(i) && strcmp(_path, _paths[i]) == 0) {
+      _capture = i;
+      break;
+    }
+  }
+}
+
+void WatchyJSON::_endValue() {
+  if (_capture >= 0) {
+    _found |= 1 << _capture;
+    _capture = -1;
+  }
+  _state = _depth > 0 ? JSON_NEXT : JSON_END;
+}
+
+void WatchyJSON::_open(char c) {
+  if (_depth >= JSON_MAX_DEPTH) {
+    _state = JSON_ERROR;
+    return;
+  }
+  _stack[_depth]  = c;
+  _prefix[_depth] = _length;
+  _index[_depth]  = 0;
+  _depth++;
+  _state = c == '{' ? JSON_KEY : JSON_VALUE;
+}
+
+void WatchyJSON::_close(char c) {
+  if (_depth == 0 || _stack[_depth - 1] != (c == '}' ? '{' : '[')) {
+    _state = JSON_ERROR;
+    return;
+  }
+  _depth--;
+  _length        = _prefix[_depth];
+  _path[_length] = '\0';
+  _endValue();
+}
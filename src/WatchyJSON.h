@@ -0,0 +1,63 @@
+#ifndef WATCHY_JSON_H
+#define WATCHY_JSON_H
+
+#include <Arduino.h>
+
+#define JSON_MAX_FIELDS   4
+#define JSON_MAX_DEPTH    8  // deeper documents are an error
+#define JSON_PATH_LENGTH  48 // longer keys never match
+#define JSON_VALUE_LENGTH 32 // longer values are cut
+
+// Pulls a few scalar fields out of a JSON document as it streams in, so the
+// body is never held in memory and no tree is built. Fields are named by
+// path, e.g. "main.temp" or "weather[0].id". Values are kept as text, string
+// escapes are reduced to the escaped character and \u sequences are not
+// decoded. Parsing stops as soon as every field is found.
+class WatchyJSON {
+public:
+  WatchyJSON(const char *const *paths, uint8_t count);
+  void feed(char c);
+  bool parse(Stream &stream); // until done() or the stream times out
+  bool done();                // all fields found, document ended or malformed
+  bool found(uint8_t field);
+  bool complete(); // all fields found
+  const char *value(uint8_t field); // "" if not found
+  long toInt(uint8_t field);
+  float toFloat(uint8_t field);
+
+private:
+  enum jsonState : uint8_t {
+    JSON_VALUE,   // a value, or ']' of an empty array
+    JSON_KEY,     // a key, or '}' of an empty object
+    JSON_COLON,   // ':' after a key
+    JSON_NEXT,    // ',' or the end of the container
+    JSON_STRING,  // inside a key or string value
+    JSON_LITERAL, // inside a number, true, false or null
+    JSON_END,     // the root value ended
+    JSON_ERROR
+  };
+  const char *const *_paths;
+  uint8_t _count;
+  uint8_t _found; // bit per field
+  uint8_t _state;
+  bool _inKey;
+  bool _escape;
+  bool _overflow;  // the current path did not fit in _path
+  int8_t _capture; // field the current value goes to, -1 if none
+  uint8_t _valueLength;
+  uint8_t _depth;
+  char _stack[JSON_MAX_DEPTH];      // '{' or '['
+  uint8_t _prefix[JSON_MAX_DEPTH];  // path length of the container
+  uint16_t _index[JSON_MAX_DEPTH];  // current array element
+  uint8_t _length;                  // of _path
+  char _path[JSON_PATH_LENGTH];
+  char _values[JSON_MAX_FIELDS][JSON_VALUE_LENGTH];
+  void _put(char c);
+  void _append(const char *text);
+  void _beginValue();
+  void _endValue();
+  void _open(char c);
+  void _close(char c);
+};
+
+#endif
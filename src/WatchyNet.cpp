@@ -0,0 +1,86 @@
+#include "WatchyNet.h"
+
+RTC_DATA_ATTR netJobState netJobs[NET_MAX_JOBS];
+
+uint8_t WatchyNet::_count;
+uint16_t WatchyNet::_interval[NET_MAX_JOBS];
+netJobCallback WatchyNet::_callback[NET_MAX_JOBS];
+void *WatchyNet::_context[NET_MAX_JOBS];
+
+int8_t WatchyNet::add(uint16_t intervalMinutes, netJobCallback callback,
+                      void *context) {
+  if (_count >= NET_MAX_JOBS) {
+    return -1;
+  }
+  _interval[_count] = intervalMinutes;
+  _callback[_count] = callback;
+  _context[_count]  = context;
+  return _count++;
+}
+
+void WatchyNet::setInterval(int8_t job, uint16_t intervalMinutes) {
+  if (job >= 0 && job < _count) {
+    _interval[job] = intervalMinutes;
+  }
+}
+
+bool WatchyNet::due(time_t now) {
+  for (uint8_t i = 0; i < _count; i++) {
+    if (_due(i, now, 0)) {
+      return true;
+    }
+  }
+  return false;
+}
+
+time_t WatchyNet::nextRun(int8_t job) {
+  return job >= 0 && job < _count ? netJobs[job].next : 0;
+}
+
+void WatchyNet::ranAt(int8_t job, time_t when) {
+  if (job >= 0 && job < _count) {
+    _schedule(job, when, true);
+  }
+}
+
+uint8_t WatchyNet::run(time_t now, bool online) {
+  uint8_t ran = 0;
+  for (uint8_t i = 0; i < _count; i++) {
+    if (_due(i, now, _interval[i] * 60UL * NET_EARLY_PERCENT / 100)) {
+      _schedule(i, now, _callback[i](_context[i], online));
+      ran++;
+    }
+  }
+  return ran;
+}
+
+// Due within early seconds, also true if the clock was set back so far that
+// the job would wait longer than any delay _schedule() picks, jitter
+// included
+bool WatchyNet::_due(uint8_t job, time_t now, uint32_t early) {
+  if (_interval[job] == 0) {
+    return false;
+  }
+  uint32_t next     = netJobs[job].next;
+  uint32_t interval = _interval[job] * 60UL;
+  uint32_t longest  = max(interval, (uint32_t)NET_RETRY_MAX * 60) *
+                      (100 + NET_JITTER_PERCENT) / 100;
+  return next == 0 || (uint32_t)now + early >= next ||
+         next - (uint32_t)now > longest;
+}
+
+void WatchyNet::_schedule(uint8_t job, time_t now, bool ok) {
+  netJobState &state = netJobs[job];
+  uint32_t delay;
+  if (ok) {
+    state.failures = 0;
+    delay          = _interval[job] * 60UL;
+  } else {
+    delay = min((uint32_t)NET_RETRY_MINUTES << min(state.failures, (uint8_t)8),
+                (uint32_t)NET_RETRY_MAX) *
+            60;
+    state.failures = min(state.failures + 1, 255);
+  }
+  delay += esp_random() % (delay * NET_JITTER_PERCENT / 100 + 1);
+  state.next = now + delay;
+}
@@ -0,0 +1,45 @@
+#ifndef WATCHY_NET_H
+#define WATCHY_NET_H
+
+#include <Arduino.h>
+#include "config.h"
+
+// Runs with WiFi up if online, or after the connect failed so the job can
+// fall back to local data. Returns false if the job failed.
+typedef bool (*netJobCallback)(void *context, bool online);
+
+typedef struct netJobState {
+  uint32_t next;    // when the job is due, 0 if it never ran
+  uint8_t failures; // in a row, sets the retry delay
+} netJobState;
+
+// Periodic network jobs that share one radio session. A session starts when
+// any job is due and also runs every job within NET_EARLY_PERCENT of its
+// interval, so jobs with related intervals drift into the same sessions
+// instead of each bringing WiFi up on its own. Each job keeps the absolute
+// time it is next due, so it runs on schedule however often the watch
+// wakes. A random jitter keeps it off a fixed phase, and failures back off
+// from NET_RETRY_MINUTES up to NET_RETRY_MAX. Times are seconds in the
+// RTC's clock (makeTime(currentTime)).
+class WatchyNet {
+public:
+  // Register jobs in the same order on every wake, their schedule is kept
+  // in RTC memory by index. An interval of 0 pauses the job.
+  static int8_t add(uint16_t intervalMinutes, netJobCallback callback,
+                    void *context);
+  static void setInterval(int8_t job, uint16_t intervalMinutes);
+  static bool due(time_t now); // a session is needed
+  static time_t nextRun(int8_t job); // 0 if it never ran
+  static void ranAt(int8_t job, time_t when); // e.g. served from a cache
+  static uint8_t run(time_t now, bool online); // returns the jobs run
+
+private:
+  static uint8_t _count;
+  static uint16_t _interval[NET_MAX_JOBS]; // minutes
+  static netJobCallback _callback[NET_MAX_JOBS];
+  static void *_context[NET_MAX_JOBS];
+  static bool _due(uint8_t job, time_t now, uint32_t early);
+  static void _schedule(uint8_t job, time_t now, bool ok);
+};
+
+#endif
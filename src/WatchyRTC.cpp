@@ -1,62 +1,175 @@
 #include "WatchyRTC.h"
 
-WatchyRTC::WatchyRTC() : rtc_ds(false) {}
+RTC_DATA_ATTR uint8_t cachedRtcType; // 0 until the first successful probe
+RTC_DATA_ATTR uint8_t alarmInterval = 1; // minutes, as last programmed
+
+WatchyRTC::WatchyRTC() : rtc_ds(false), _pcfMinute(-1) {}
 
 void WatchyRTC::init() {
-  byte error;
-  Wire.beginTransmission(RTC_DS_ADDR);
-  error = Wire.endTransmission();
-  if (error == 0) {
+  // the RTC chip cannot change while we are asleep, so only probe the bus on
+  // reset or after an I2C error cleared the cache
+  esp_sleep_wakeup_cause_t wakeup_reason = esp_sleep_get_wakeup_cause();
+  if (cachedRtcType != 0 && (wakeup_reason == ESP_SLEEP_WAKEUP_EXT0 ||
+                             wakeup_reason == ESP_SLEEP_WAKEUP_EXT1)) {
+    rtcType = cachedRtcType;
+    return;
+  }
+  _probe();
+}
+
+void WatchyRTC::_probe() {
+  if (WatchyI2C::probe(RTC_DS_ADDR) == I2C_OK) {
     rtcType = DS3231;
+  } else if (WatchyI2C::probe(RTC_PCF_ADDR) == I2C_OK) {
+    rtcType = PCF8563;
+  } else {
+    rtcType = 0; // RTC Error
+  }
+  cachedRtcType = rtcType;
+}
+
+void WatchyRTC::config(const char *datetime) {
+  tmElements_t tm;
+  bool valid = datetime[0] != '\0' && parseDateTime(datetime, tm);
+  if (valid) {
+    set(tm);
+  }
+  if (rtcType == DS3231) {
+    _DSConfig();
+  } else if (!valid) { // set() already re-armed the alarm
+    // on POR event, PCF8563 sets month to 0, which will give an error since
+    // months are 1-12
+    clearAlarm();
+  }
+}
+
+void WatchyRTC::clearAlarm(uint8_t interval) {
+  if (rtcType == DS3231) {
+    rtc_ds.alarm(DS3232RTC::ALARM_2);
+    if (interval > 1) {
+      rtc_ds.setAlarm(DS3232RTC::ALM2_MATCH_MINUTES, 0,
+                      _nextTick(minute(rtc_ds.get()), interval), 0, 0);
+    } else if (alarmInterval > 1) { // back to the alarm set by _DSConfig
+      rtc_ds.setAlarm(DS3232RTC::ALM2_EVERY_MINUTE, 0, 0, 0, 0);
+    }
+  } else {
+    // reuse the minute read on this wake unless it may have rolled over
+    if (_pcfMinute < 0 || _pcfSecond + (millis() - _pcfReadMs) / 1000 >= 59) {
+      uint8_t regs[3]; // control_status_2, seconds, minutes
+      if (!_readPCF(regs, sizeof(regs))) {
+        return; // the flag stays set, so the next wake is immediate and retries
+      }
+    }
+    // minute alarm only, then clear AF and keep the alarm interrupt on. The
+    // time registers sit between the two, so these are two writes.
+    uint8_t alarm[4] = {_bin2bcd(_nextTick(_pcfMinute, interval)),
+                        PCF_ALARM_DISABLE, PCF_ALARM_DISABLE,
+                        PCF_ALARM_DISABLE};
+    WatchyI2C::write(RTC_PCF_ADDR, PCF_ALARM_MINUTE, alarm, sizeof(alarm));
+    _writePCFStatus(PCF_ALARM_AIE, PCF_ALARM_AF);
+  }
+  alarmInterval = interval;
+}
+
+void WatchyRTC::scheduleWake(uint32_t seconds) {
+  seconds = max(seconds, (uint32_t)1);
+  if (rtcType == DS3231) {
+    time_t when = rtc_ds.get() + seconds;
+    rtc_ds.alarm(DS3232RTC::ALARM_1); // drop a flag left from before
+    rtc_ds.setAlarm(DS3232RTC::ALM1_MATCH_DATE, second(when), minute(when),
+                    hour(when), day(when));
+    rtc_ds.alarmInterrupt(DS3232RTC::ALARM_1, true);
   } else {
-    Wire.beginTransmission(RTC_PCF_ADDR);
-    error = Wire.endTransmission();
-    if (error == 0) {
-      rtcType = PCF8563;
-    } else {
-      // RTC Error
+    uint8_t timer[2] = {PCF_TIMER_ENABLE | PCF_TIMER_1HZ, (uint8_t)seconds};
+    if (seconds > 255) {
+      timer[0] = PCF_TIMER_ENABLE | PCF_TIMER_MINUTE;
+      timer[1] = min((seconds + 30) / 60, (uint32_t)255);
     }
+    WatchyI2C::write(RTC_PCF_ADDR, PCF_TIMER_CONTROL, timer, sizeof(timer));
+    _writePCFStatus(PCF_TIMER_TIE, PCF_TIMER_TF);
   }
 }
 
-void WatchyRTC::config(
-    String datetime) { // String datetime format is YYYY:MM:DD:HH:MM:SS
+void WatchyRTC::scheduleWakeAt(time_t when) {
+  tmElements_t tm;
+  read(tm);
+  time_t now = makeTime(tm);
+  scheduleWake(when > now ? when - now : 1);
+}
+
+void WatchyRTC::cancelWake() {
   if (rtcType == DS3231) {
-    _DSConfig(datetime);
+    rtc_ds.alarmInterrupt(DS3232RTC::ALARM_1, false);
+    rtc_ds.alarm(DS3232RTC::ALARM_1);
   } else {
-    _PCFConfig(datetime);
+    uint8_t control = PCF_TIMER_MINUTE; // stopped
+    WatchyI2C::write(RTC_PCF_ADDR, PCF_TIMER_CONTROL, &control, 1);
+    _writePCFStatus(0, PCF_TIMER_TIE | PCF_TIMER_TF);
   }
 }
 
-void WatchyRTC::clearAlarm() {
+// Both wakes share the interrupt line. The tick flag is left for
+// clearAlarm(), a scheduled wake is one-shot and cancelled here. Read
+// errors count as a tick, as before there were scheduled wakes.
+uint8_t WatchyRTC::pendingWakes() {
+  uint8_t wakes = 0;
   if (rtcType == DS3231) {
-    rtc_ds.alarm(DS3232RTC::ALARM_2);
+    uint8_t status = rtc_ds.readRTC(DS_STATUS);
+    if (status & DS_ALARM_2) {
+      wakes |= RTC_WAKE_TICK;
+    }
+    // A1F is set on every match, even with the interrupt disabled, so only
+    // counts while A1IE is on, like TF and TIE on the PCF8563
+    if ((status & DS_ALARM_1) && (rtc_ds.readRTC(DS_CONTROL) & DS_ALARM_1)) {
+      wakes |= RTC_WAKE_SCHEDULED;
+    }
   } else {
-    int nextAlarmMinute = 0;
-    rtc_pcf.clearAlarm(); // resets the alarm flag in the RTC
-    nextAlarmMinute = rtc_pcf.getMinute();
-    nextAlarmMinute =
-        (nextAlarmMinute == 59)
-            ? 0
-            : (nextAlarmMinute + 1); // set alarm to trigger 1 minute from now
-    rtc_pcf.setAlarm(nextAlarmMinute, 99, 99, 99);
+    uint8_t regs[3]; // control_status_2, seconds, minutes
+    if (!_readPCF(regs, sizeof(regs))) {
+      return RTC_WAKE_TICK;
+    }
+    if (regs[0] & PCF_ALARM_AF) {
+      wakes |= RTC_WAKE_TICK;
+    }
+    if ((regs[0] & PCF_TIMER_TF) && (regs[0] & PCF_TIMER_TIE)) {
+      wakes |= RTC_WAKE_SCHEDULED;
+    }
+  }
+  if (wakes & RTC_WAKE_SCHEDULED) {
+    cancelWake();
   }
+  return wakes != 0 ? wakes : RTC_WAKE_TICK;
+}
+
+// next multiple of interval, so slow ticks still land on the hour
+uint8_t WatchyRTC::_nextTick(uint8_t minute, uint8_t interval) {
+  return (minute / interval + 1) * interval % 60;
 }
 
 void WatchyRTC::read(tmElements_t &tm) {
   if (rtcType == DS3231) {
-    rtc_ds.read(tm);
+    if (rtc_ds.read(tm) != 0) {
+      _probe(); // I2C error, the cached chip type may be stale
+    }
   } else {
-    rtc_pcf.getDateTime();
-    tm.Year  = y2kYearToTm(rtc_pcf.getYear());
-    tm.Month = rtc_pcf.getMonth();
-    tm.Day   = rtc_pcf.getDay();
-    tm.Wday =
-        rtc_pcf.getWeekday() + 1; // TimeLib & DS3231 has Wday range of 1-7, but
-                                  // PCF8563 stores day of week in 0-6 range
-    tm.Hour   = rtc_pcf.getHour();
-    tm.Minute = rtc_pcf.getMinute();
-    tm.Second = rtc_pcf.getSecond();
+    // control_status_2 through years in one burst
+    uint8_t regs[8];
+    if (!_readPCF(regs, sizeof(regs))) {
+      _probe(); // I2C error, the cached chip type may be stale
+      return;
+    }
+    tm.Second = _pcfSecond;
+    tm.Minute = _pcfMinute;
+    tm.Hour   = _bcd2bin(regs[3] & 0x3F);
+    tm.Day    = _bcd2bin(regs[4] & 0x3F);
+    tm.Wday   = (regs[5] & 0x07) + 1; // TimeLib & DS3231 has Wday range of
+                                      // 1-7, but PCF8563 stores day of week
+                                      // in 0-6 range
+    tm.Month = _bcd2bin(regs[6] & 0x1F);
+    tm.Year  = y2kYearToTm(_bcd2bin(regs[7]));
+    if (tm.Month < 1 || tm.Month > 12 || tm.Hour > 23) {
+      _probe(); // garbage from the bus, the cached chip type may be stale
+    }
   }
 }
 
@@ -74,10 +187,47 @@ void WatchyRTC::set(tmElements_t tm) {
                                // PCF8563 stores day of week in 0-6 range
     // hr, min, sec
     rtc_pcf.setTime(tm.Hour, tm.Minute, tm.Second);
+    _pcfMinute = -1;
     clearAlarm();
   }
 }
 
+// Reads len registers from control_status_2 on, at least up to the minutes
+bool WatchyRTC::_readPCF(uint8_t *regs, uint8_t len) {
+  if (WatchyI2C::read(RTC_PCF_ADDR, PCF_STATUS2, regs, len) != I2C_OK) {
+    return false;
+  }
+  _pcfReadMs  = millis();
+  _pcfStatus2 = regs[0];
+  _pcfSecond  = _bcd2bin(regs[1] & 0x7F); // bit 7 flags a voltage low
+  _pcfMinute  = _bcd2bin(regs[2] & 0x7F);
+  return true;
+}
+
+// AF and TF are written as 1, which keeps them, unless they are in clear.
+// The other bits are configuration only this class writes, so the copy
+// from the last read stays valid.
+bool WatchyRTC::_writePCFStatus(uint8_t set, uint8_t clear) {
+  if (_pcfMinute < 0) {
+    uint8_t regs[3];
+    if (!_readPCF(regs, sizeof(regs))) {
+      return false;
+    }
+  }
+  _pcfStatus2 =
+      ((_pcfStatus2 | PCF_ALARM_AF | PCF_TIMER_TF) & ~clear & 0x1F) | set;
+  return WatchyI2C::write(RTC_PCF_ADDR, PCF_STATUS2, &_pcfStatus2, 1) ==
+         I2C_OK;
+}
+
+uint8_t WatchyRTC::_bcd2bin(uint8_t bcd) {
+  return (bcd >> 4) * 10 + (bcd & 0x0F);
+}
+
+uint8_t WatchyRTC::_bin2bcd(uint8_t bin) {
+  return ((bin / 10) << 4) | (bin % 10);
+}
+
 uint8_t WatchyRTC::temperature() {
   if (rtcType == DS3231) {
     return rtc_ds.temperature();
@@ -86,20 +236,7 @@ uint8_t WatchyRTC::temperature() {
   }
 }
 
-void WatchyRTC::_DSConfig(
-    String datetime) { // String datetime is YYYY:MM:DD:HH:MM:SS
-  if (datetime != "") {
-    tmElements_t tm;
-    tm.Year = CalendarYrToTm(_getValue(datetime, ':', 0).toInt()); // YYYY -
-                                                                   // 1970
-    tm.Month  = _getValue(datetime, ':', 1).toInt();
-    tm.Day    = _getValue(datetime, ':', 2).toInt();
-    tm.Hour   = _getValue(datetime, ':', 3).toInt();
-    tm.Minute = _getValue(datetime, ':', 4).toInt();
-    tm.Second = _getValue(datetime, ':', 5).toInt();
-    time_t t  = makeTime(tm);
-    rtc_ds.set(t);
-  }
+void WatchyRTC::_DSConfig() {
   // https://github.com/JChristensen/DS3232RTC
   rtc_ds.squareWave(DS3232RTC::SQWAVE_NONE); // disable square wave output
   rtc_ds.setAlarm(DS3232RTC::ALM2_EVERY_MINUTE, 0, 0, 0,
@@ -107,44 +244,99 @@ void WatchyRTC::_DSConfig(
   rtc_ds.alarmInterrupt(DS3232RTC::ALARM_2, true); // enable alarm interrupt
 }
 
-void WatchyRTC::_PCFConfig(
-    String datetime) { // String datetime is YYYY:MM:DD:HH:MM:SS
-  if (datetime != "") {
-    tmElements_t tm;
-    tm.Year = CalendarYrToTm(_getValue(datetime, ':', 0).toInt()); // YYYY -
-                                                                   // 1970
-    tm.Month  = _getValue(datetime, ':', 1).toInt();
-    tm.Day    = _getValue(datetime, ':', 2).toInt();
-    tm.Hour   = _getValue(datetime, ':', 3).toInt();
-    tm.Minute = _getValue(datetime, ':', 4).toInt();
-    tm.Second = _getValue(datetime, ':', 5).toInt();
-    time_t t  = makeTime(tm); // make and break to calculate tm.Wday
-    breakTime(t, tm);
-    // day, weekday, month, century(1=1900, 0=2000), year(0-99)
-    rtc_pcf.setDate(
-        tm.Day, tm.Wday - 1, tm.Month, 0,
-        tmYearToY2k(tm.Year)); // TimeLib & DS3231 has Wday range of 1-7, but
-                               // PCF8563 stores day of week in 0-6 range
-    // hr, min, sec
-    rtc_pcf.setTime(tm.Hour, tm.Minute, tm.Second);
+// One pass over the string, no String copies. The form is picked by the
+// first field: a month name, or the year followed by ':' or '-'.
+bool WatchyRTC::parseDateTime(const char *datetime, tmElements_t &tm) {
+  static const uint8_t monthDays[] = {31, 29, 31, 30, 31, 30,
+                                      31, 31, 30, 31, 30, 31};
+  const char *p = datetime;
+  uint16_t year, month, day, hour, minute, second = 0;
+  bool legacy = false;
+  if (isalpha(*p)) { // __DATE__ " " __TIME__, the day is padded with a space
+    month = _parseMonthName(p);
+    if (month == 0 || !_parseSeparator(p, ' ') || !_parseNumber(p, 2, day) ||
+        !_parseSeparator(p, ' ') || !_parseNumber(p, 4, year) ||
+        !_parseSeparator(p, ' ')) {
+      return false;
+    }
+  } else {
+    if (!_parseNumber(p, 4, year)) {
+      return false;
+    }
+    legacy = *p == ':';
+    char separator = legacy ? ':' : '-';
+    if (!_parseSeparator(p, separator) || !_parseNumber(p, 2, month) ||
+        !_parseSeparator(p, separator) || !_parseNumber(p, 2, day)) {
+      return false;
+    }
+    if (legacy ? *p != ':' : *p != 'T' && *p != ' ') {
+      return false;
+    }
+    p++;
+  }
+  if (!_parseNumber(p, 2, hour) || !_parseSeparator(p, ':') ||
+      !_parseNumber(p, 2, minute)) {
+    return false;
+  }
+  if (*p == ':' && (!_parseSeparator(p, ':') || !_parseNumber(p, 2, second))) {
+    return false;
   }
-  // on POR event, PCF8563 sets month to 0, which will give an error since
-  // months are 1-12
-  clearAlarm();
+  if (!legacy) {
+    if (*p == '.' || *p == ',') { // fraction of a second
+      for (p++; isdigit(*p); p++) {
+      }
+    }
+    uint16_t offset; // +HH, +HHMM or +HH:MM
+    if (*p == 'Z') {
+      p++;
+    } else if ((*p == '+' || *p == '-') &&
+               (!_parseNumber(++p, 4, offset) ||
+                (*p == ':' && !_parseNumber(++p, 2, offset)))) {
+      return false;
+    }
+  }
+  bool leap = year % 4 == 0; // enough for 2000-2099
+  if (*p != '\0' || year < 2000 || year > 2099 || month < 1 || month > 12 ||
+      day < 1 || day > monthDays[month - 1] ||
+      (month == 2 && day == 29 && !leap) || hour > 23 || minute > 59 ||
+      second > 59) {
+    return false;
+  }
+  tm.Year   = CalendarYrToTm(year);
+  tm.Month  = month;
+  tm.Day    = day;
+  tm.Hour   = hour;
+  tm.Minute = minute;
+  tm.Second = second;
+  return true;
 }
 
-String WatchyRTC::_getValue(String data, char separator, int index) {
-  int found      = 0;
-  int strIndex[] = {0, -1};
-  int maxIndex   = data.length() - 1;
+bool WatchyRTC::_parseNumber(const char *&p, uint8_t maxDigits,
+                             uint16_t &value) {
+  uint8_t digits = 0;
+  for (value = 0; digits < maxDigits && isdigit(*p); digits++, p++) {
+    value = value * 10 + (*p - '0');
+  }
+  return digits > 0 && !isdigit(*p);
+}
 
-  for (int i = 0; i <= maxIndex && found <= index; i++) {
-    if (data.charAt(i) == separator || i == maxIndex) {
-      found++;
-      strIndex[0] = strIndex[1] + 1;
-      strIndex[1] = (i == maxIndex) ? i + 1 : i;
-    }
+// One separator, or a run of them for the space padded __DATE__ fields
+bool WatchyRTC::_parseSeparator(const char *&p, char separator) {
+  if (*p != separator) {
+    return false;
   }
+  for (p++; separator == ' ' && *p == ' '; p++) {
+  }
+  return true;
+}
 
-  return found > index ? data.substring(strIndex[0], strIndex[1]) : "";
+uint8_t WatchyRTC::_parseMonthName(const char *&p) {
+  static const char months[] = "JanFebMarAprMayJunJulAugSepOctNovDec";
+  for (uint8_t i = 0; i < 12; i++) {
+    if (strncmp(p, months + i * 3, 3) == 0) {
+      p += 3;
+      return i + 1;
+    }
+  }
+  return 0;
 }
@@ -2,6 +2,7 @@
 #define WATCHY_RTC_H
 
 #include "config.h"
+#include "WatchyI2C.h"
 #include "time.h"
 #include <DS3232RTC.h>
 #include <Rtc_Pcf8563.h>
@@ -12,6 +13,27 @@
 #define RTC_PCF_ADDR    0x51
 #define YEAR_OFFSET_DS  1970
 #define YEAR_OFFSET_PCF 2000
+// PCF8563 registers and control_status_2 bits
+#define PCF_STATUS2       0x01
+#define PCF_SECONDS       0x02
+#define PCF_ALARM_MINUTE  0x09
+#define PCF_ALARM_AF      0x08 // writing 1 to AF or TF leaves the flag as is
+#define PCF_TIMER_TF      0x04
+#define PCF_ALARM_AIE     0x02
+#define PCF_TIMER_TIE     0x01
+#define PCF_ALARM_DISABLE 0x80
+#define PCF_TIMER_CONTROL 0x0E // followed by the countdown value
+#define PCF_TIMER_ENABLE  0x80
+#define PCF_TIMER_1HZ     0x02
+#define PCF_TIMER_MINUTE  0x03 // 1/60 Hz, also the low power setting
+// DS3231 status register flags, and the control register's enable bits
+#define DS_CONTROL   0x0E
+#define DS_STATUS    0x0F
+#define DS_ALARM_1   0x01 // A1F in status, A1IE in control
+#define DS_ALARM_2   0x02 // A2F in status, A2IE in control
+// what pulled the RTC interrupt line, see pendingWakes()
+#define RTC_WAKE_TICK      0x01 // the alarm set by clearAlarm()
+#define RTC_WAKE_SCHEDULED 0x02 // the wake set by scheduleWake()
 
 class WatchyRTC {
 public:
@@ -22,17 +44,42 @@ public:
 public:
   WatchyRTC();
   void init();
-  void config(String datetime); // String datetime format is YYYY:MM:DD:HH:MM:SS
-  void clearAlarm();
+  void config(const char *datetime); // see parseDateTime(), "" keeps the time
+  void clearAlarm(uint8_t interval = 1); // next alarm in interval minutes
+  // One extra wake on top of the ticks. DS3231 uses alarm 1 and is exact to
+  // the second. PCF8563 uses its countdown timer: exact to the second up to
+  // 255 s, then rounded to the minute, up to 255 minutes.
+  void scheduleWake(uint32_t seconds);
+  void scheduleWakeAt(time_t when); // in the RTC's clock, like makeTime()
+  void cancelWake();
+  uint8_t pendingWakes(); // RTC_WAKE_* flags, acknowledges a scheduled wake
   void read(tmElements_t &tm);
   void set(tmElements_t tm);
   uint8_t temperature();
+  // Accepts "YYYY:MM:DD:HH:MM:SS", ISO-8601 ("2026-10-17T09:30:00", seconds,
+  // fraction and UTC offset optional, the offset is ignored) and the
+  // compiler's __DATE__ " " __TIME__ ("Oct 17 2026 09:30:00"). Returns false
+  // and leaves tm alone unless the whole string is a valid date in 2000-2099.
+  static bool parseDateTime(const char *datetime, tmElements_t &tm);
 
 private:
-  void _DSConfig(String datetime);
-  void _PCFConfig(String datetime);
+  // control_status_2 and the time as of the last PCF8563 read, so the
+  // alarm can be re-armed without reading them again
+  uint8_t _pcfStatus2;
+  int8_t _pcfMinute; // -1 if not read since the last set
+  uint8_t _pcfSecond;
+  uint32_t _pcfReadMs;
+  bool _readPCF(uint8_t *regs, uint8_t len);
+  bool _writePCFStatus(uint8_t set, uint8_t clear);
+  static uint8_t _bcd2bin(uint8_t bcd);
+  static uint8_t _bin2bcd(uint8_t bin);
+  void _probe();
+  uint8_t _nextTick(uint8_t minute, uint8_t interval);
+  void _DSConfig();
   int _getDayOfWeek(int d, int m, int y);
-  String _getValue(String data, char separator, int index);
+  static bool _parseNumber(const char *&p, uint8_t maxDigits, uint16_t &value);
+  static bool _parseSeparator(const char *&p, char separator);
+  static uint8_t _parseMonthName(const char *&p);
 };
 
 #endif
\ No newline at end of file
@@ -0,0 +1,149 @@
+#include "WatchyTrace.h"
+
+RTC_DATA_ATTR traceRecord traceLog[TRACE_DEPTH];
+RTC_DATA_ATTR uint16_t traceHead;  // next slot to write
+RTC_DATA_ATTR uint16_t traceCount; // valid records, saturates at TRACE_DEPTH
+RTC_DATA_ATTR traceEventStats traceEvents[TRACE_EVENTS];
+
+bool WatchyTrace::_active;
+uint8_t WatchyTrace::_wakeupReason;
+uint32_t WatchyTrace::_started[TRACE_PHASES];
+uint32_t WatchyTrace::_elapsed[TRACE_PHASES];
+
+void WatchyTrace::begin(uint8_t wakeupReason) {
+  _active       = true;
+  _wakeupReason = wakeupReason;
+  memset(_elapsed, 0, sizeof(_elapsed));
+}
+
+void WatchyTrace::start(uint8_t phase) { _started[phase] = micros(); }
+
+void WatchyTrace::stop(uint8_t phase) {
+  _elapsed[phase] += micros() - _started[phase];
+}
+
+void WatchyTrace::add(uint8_t phase, uint32_t us) { _elapsed[phase] += us; }
+
+void WatchyTrace::commit() {
+  if (!_active) {
+    return;
+  }
+  _elapsed[TRACE_AWAKE] = micros();
+  traceRecord &record   = traceLog[traceHead];
+  record.wakeupReason   = _wakeupReason;
+  for (uint8_t i = 0; i < TRACE_PHASES; i++) {
+    record.phase[i] = encode(_elapsed[i]);
+  }
+  traceHead = (traceHead + 1) % TRACE_DEPTH;
+  if (traceCount < TRACE_DEPTH) {
+    traceCount++;
+  }
+  _active = false;
+}
+
+void WatchyTrace::event(uint8_t event, uint32_t us) {
+  traceEventStats &stats = traceEvents[event];
+  stats.count++;
+  stats.lastUs = us;
+  stats.maxUs  = max(stats.maxUs, us);
+}
+
+const traceEventStats &WatchyTrace::eventStats(uint8_t event) {
+  return traceEvents[event];
+}
+
+uint16_t WatchyTrace::count() { return traceCount; }
+
+uint32_t WatchyTrace::percentile(uint8_t phase, uint8_t pct) {
+  uint8_t codes[TRACE_DEPTH];
+  uint16_t n = _sortedCodes(phase, codes);
+  if (n == 0) {
+    return 0;
+  }
+  return decode(codes[(n - 1) * pct / 100]);
+}
+
+void WatchyTrace::dump(Print &out) {
+  uint8_t codes[TRACE_DEPTH];
+  out.printf("wake trace: %u wakes\n", traceCount);
+  out.println("phase     p50 ms   p90 ms   max ms");
+  for (uint8_t i = 0; i < TRACE_PHASES; i++) {
+    uint16_t n = _sortedCodes(i, codes);
+    if (n == 0) {
+      continue;
+    }
+    out.printf("%-6s %9.2f %8.2f %8.2f\n", phaseName(i),
+               decode(codes[(n - 1) / 2]) / 1000.0f,
+               decode(codes[(n - 1) * 90 / 100]) / 1000.0f,
+               decode(codes[n - 1]) / 1000.0f);
+  }
+  for (uint8_t i = 0; i < TRACE_EVENTS; i++) {
+    if (traceEvents[i].count == 0) {
+      continue;
+    }
+    out.printf("%-6s %9.2f ms last, %.2f ms max, %u times\n", eventName(i),
+               traceEvents[i].lastUs / 1000.0f, traceEvents[i].maxUs / 1000.0f,
+               traceEvents[i].count);
+  }
+  // one bucket per power of two, straight from the exponent bits
+  for (uint8_t i = 0; i < TRACE_PHASES; i++) {
+    uint16_t buckets[16] = {0};
+    for (uint16_t j = 0; j < traceCount; j++) {
+      buckets[traceLog[j].phase[i] >> 4]++;
+    }
+    out.printf("\n%s histogram\n", phaseName(i));
+    for (uint8_t b = 0; b < 16; b++) {
+      if (buckets[b] == 0) {
+        continue;
+      }
+      out.printf("  >= %8.2f ms %4u |", decode(b << 4) / 1000.0f, buckets[b]);
+      for (uint16_t k = 0; k < buckets[b] * 40 / traceCount; k++) {
+        out.print('#');
+      }
+      out.println();
+    }
+  }
+}
+
+const char *WatchyTrace::phaseName(uint8_t phase) {
+  const char *names[TRACE_PHASES] = {"i2c",  "init", "draw", "disp",
+                                     "busy", "hib",  "awake"};
+  return phase < TRACE_PHASES ? names[phase] : "?";
+}
+
+const char *WatchyTrace::eventName(uint8_t event) {
+  const char *names[TRACE_EVENTS] = {"bma", "sec", "wifi"};
+  return event < TRACE_EVENTS ? names[event] : "?";
+}
+
+// 4 bit exponent, 4 bit mantissa in units of TRACE_UNIT_US: exact below
+// 16 units, ~6% steps above, saturates at 0xFF (about 8 s)
+uint8_t WatchyTrace::encode(uint32_t us) {
+  uint32_t v = us / TRACE_UNIT_US;
+  if (v < 16) {
+    return v;
+  }
+  uint8_t bit = 31 - __builtin_clz(v);
+  if (bit > 18) {
+    return 0xFF;
+  }
+  return ((bit - 3) << 4) | ((v >> (bit - 4)) & 0x0F);
+}
+
+uint32_t WatchyTrace::decode(uint8_t code) {
+  uint8_t e = code >> 4;
+  uint8_t m = code & 0x0F;
+  if (e == 0) {
+    return m * TRACE_UNIT_US;
+  }
+  return ((uint32_t)(16 | m) << (e - 1)) * TRACE_UNIT_US;
+}
+
+uint16_t WatchyTrace::_sortedCodes(uint8_t phase, uint8_t *codes) {
+  for (uint16_t i = 0; i < traceCount; i++) {
+    codes[i] = traceLog[i].phase[phase];
+  }
+  // codes are monotonic in duration, so sorting them sorts the durations
+  std::sort(codes, codes + traceCount);
+  return traceCount;
+}
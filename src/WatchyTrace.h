@@ -0,0 +1,64 @@
+#ifndef WATCHY_TRACE_H
+#define WATCHY_TRACE_H
+
+#include <Arduino.h>
+#include "config.h"
+
+enum tracePhase {
+  TRACE_I2C = 0,      // Wire.begin, RTC probe, BMA423 check
+  TRACE_DISPLAY_INIT, // display.init
+  TRACE_DRAW,         // drawWatchFace
+  TRACE_DISPLAY,      // display.display, including the busy wait
+  TRACE_BUSY,         // light sleep while the panel is busy
+  TRACE_HIBERNATE,    // display.hibernate, alarm re-arm, pin setup
+  TRACE_AWAKE,        // app start until deep sleep
+  TRACE_PHASES
+};
+
+// Rare, slow operations that would waste a byte in every traceRecord
+enum traceEvent {
+  TRACE_BMA_BEGIN = 0, // BMA423 reset, config upload and ASIC init
+  TRACE_SECONDS,       // one seconds mode tick, draw and panel update
+  TRACE_WIFI_CONNECT,  // connectWiFi() until associated with an IP
+  TRACE_EVENTS
+};
+
+typedef struct traceEventStats {
+  uint16_t count;
+  uint32_t lastUs;
+  uint32_t maxUs;
+} traceEventStats;
+
+// One wake. Durations are stored as 8 bit minifloats (see encode()) so a
+// few hundred wakes fit in RTC memory.
+typedef struct traceRecord {
+  uint8_t wakeupReason;
+  uint8_t phase[TRACE_PHASES];
+} traceRecord;
+
+class WatchyTrace {
+public:
+  static void begin(uint8_t wakeupReason);
+  static void start(uint8_t phase);
+  static void stop(uint8_t phase);
+  static void add(uint8_t phase, uint32_t us);
+  static void commit(); // store the current wake in the ring buffer
+  static void event(uint8_t event, uint32_t us);
+  static const traceEventStats &eventStats(uint8_t event);
+  static uint16_t count();
+  static uint32_t percentile(uint8_t phase, uint8_t pct); // in us
+  static void dump(Print &out);
+  static const char *phaseName(uint8_t phase);
+  static const char *eventName(uint8_t event);
+  static uint8_t encode(uint32_t us);
+  static uint32_t decode(uint8_t code);
+
+private:
+  static bool _active;
+  static uint8_t _wakeupReason;
+  static uint32_t _started[TRACE_PHASES];
+  static uint32_t _elapsed[TRACE_PHASES];
+  static uint16_t _sortedCodes(uint8_t phase, uint8_t *codes);
+};
+
+#endif
@@ -1,5 +1,18 @@
 #include "bma.h"
 
+// Config stream chunk for the upload in begin(): even, divides
+// BMA4_CONFIG_STREAM_SIZE, and fits the 128 byte Wire buffer together with
+// the register address
+#define BMA423_STREAM_BURST 96
+
+// FIFO data register reads pop frames, so a drain can be split across
+// transfers at frame boundaries: 21 accel frames fit the Wire buffer
+#define BMA423_FIFO_BURST (21 * BMA4_FIFO_A_LENGTH)
+#define BMA423_FIFO_SIZE  1024
+#define BMA423_FIFO_FLUSH 0xB0
+
+extern "C" const uint8_t bma423_config_file[];
+
 #define DEBUGPORT Serial
 #ifdef DEBUGPORT
 #define DEBUG(...) DEBUGPORT.printf(__VA_ARGS__)
@@ -47,10 +60,20 @@ bool BMA423::begin(bma4_com_fptr_t readCallBlack,
     return false;
   }
 
-  if (bma423_write_config_file(&__devFptr) != BMA4_OK) {
+  // bma423_write_config_file() caps chunks at the 64 byte feature size
+  // because read_write_len also sizes feature reads; the stream itself takes
+  // any even length, so push it in bursts and use feature-sized transfers
+  // from then on
+  __devFptr.read_write_len  = BMA423_STREAM_BURST;
+  __devFptr.config_file_ptr = bma423_config_file;
+  uint16_t rslt             = bma4_write_config_file(&__devFptr);
+  __devFptr.read_write_len  = BMA423_FEATURE_SIZE;
+  if (rslt != BMA4_OK) {
     DEBUG("BMA423 Write Config FAIL\n");
     return false;
   }
+  bma423_get_config_id(&__configId, &__devFptr);
+  __fifoFrames = 0; // the soft reset cleared the FIFO config
 
   __init = true;
 
@@ -68,6 +91,43 @@ bool BMA423::begin(bma4_com_fptr_t readCallBlack,
   return true;
 }
 
+// Re-attaches the bus callbacks, which the constructor clears on every
+// boot, and checks that the sensor still runs the config begin() uploaded.
+// Returns false when begin() has to run again.
+bool BMA423::restore(bma4_com_fptr_t readCallBlack,
+                     bma4_com_fptr_t writeCallBlack,
+                     bma4_delay_fptr_t delayCallBlack) {
+  __readRegisterFptr   = readCallBlack;
+  __writeRegisterFptr  = writeCallBlack;
+  __delayCallBlackFptr = delayCallBlack;
+  __devFptr.bus_read   = readCallBlack;
+  __devFptr.bus_write  = writeCallBlack;
+  __devFptr.delay      = delayCallBlack;
+
+  // chip_id is only set once bma423_init() succeeded since the last reset
+  if (__devFptr.chip_id != BMA423_CHIP_ID || !configResident()) {
+    return false;
+  }
+  __init = true;
+  return true;
+}
+
+// The ASIC reports init_ok and the feature config carries the config id read
+// after the upload. A brown-out or sensor reset fails the first test, a
+// corrupted config the second. Bits 5 and 6 of the status are error flags,
+// an ODR below 50 Hz with the FIFO on sets bit 6, so only the message field
+// is compared.
+bool BMA423::configResident() {
+  uint8_t status = 0;
+  uint16_t id    = 0;
+  if (bma4_read_regs(BMA4_INTERNAL_STAT, &status, 1, &__devFptr) != BMA4_OK ||
+      (status & 0x1F) != BMA4_ASIC_INITIALIZED) {
+    return false;
+  }
+  return bma423_get_config_id(&id, &__devFptr) == BMA4_OK &&
+         id == __configId;
+}
+
 void BMA423::softReset() {
   uint8_t reg = BMA4_RESET_ADDR;
   __writeRegisterFptr(BMA4_I2C_ADDR_PRIMARY, BMA4_RESET_SET_MASK, &reg, 1);
@@ -186,6 +246,77 @@ bool BMA423::setRemapAxes(struct bma423_axes_remap *remap_data) {
   return (BMA4_OK == bma423_set_remap_axes(remap_data, &__devFptr));
 }
 
+bool BMA423::setAnyMotionConfig(struct bma423_anymotion_config &config) {
+  return (BMA4_OK == bma423_set_any_motion_config(&config, &__devFptr));
+}
+
+bool BMA423::enableAnyMotionAxis(uint8_t axis) {
+  return (BMA4_OK == bma423_anymotion_enable_axis(axis, &__devFptr));
+}
+
+// Buffers headerless accel frames at odr (BMA4_OUTPUT_DATA_RATE_*) and
+// raises INT1 once frames of them are waiting, up to 170 (1 KB FIFO).
+bool BMA423::enableFIFO(uint8_t odr, uint16_t frames) {
+  Acfg cfg;
+  frames = constrain(frames, 1, BMA423_FIFO_SIZE / BMA4_FIFO_A_LENGTH);
+  if (!getAccelConfig(cfg)) {
+    return false;
+  }
+  cfg.odr = odr;
+  if (!setAccelConfig(cfg) ||
+      bma4_set_fifo_config(BMA4_FIFO_HEADER | BMA4_FIFO_TIME |
+                               BMA4_FIFO_STOP_ON_FULL,
+                           BMA4_DISABLE, &__devFptr) != BMA4_OK ||
+      bma4_set_fifo_config(BMA4_FIFO_ACCEL, BMA4_ENABLE, &__devFptr) !=
+          BMA4_OK ||
+      bma4_set_fifo_wm(frames * BMA4_FIFO_A_LENGTH, &__devFptr) != BMA4_OK ||
+      bma4_set_command_register(BMA423_FIFO_FLUSH, &__devFptr) != BMA4_OK ||
+      bma423_map_interrupt(BMA4_INTR1_MAP, BMA4_FIFO_WM_INT, BMA4_ENABLE,
+                           &__devFptr) != BMA4_OK) {
+    return false;
+  }
+  __fifoFrames = frames;
+  return true;
+}
+
+bool BMA423::disableFIFO() {
+  __fifoFrames = 0;
+  return bma423_map_interrupt(BMA4_INTR1_MAP, BMA4_FIFO_WM_INT, BMA4_DISABLE,
+                              &__devFptr) == BMA4_OK &&
+         bma4_set_fifo_config(BMA4_FIFO_ACCEL, BMA4_DISABLE, &__devFptr) ==
+             BMA4_OK;
+}
+
+bool BMA423::isFIFOEnabled() { return __fifoFrames != 0; }
+
+// Drains up to size bytes of the FIFO into buffer and unpacks up to count
+// samples from them. Returns the number of samples, 0 on a bus error.
+uint16_t BMA423::readFIFO(uint8_t *buffer, uint16_t size, Accel *samples,
+                          uint16_t count) {
+  uint16_t length = 0;
+  if (bma4_get_fifo_length(&length, &__devFptr) != BMA4_OK) {
+    return 0;
+  }
+  length = min(length, size);
+  length -= length % BMA4_FIFO_A_LENGTH;
+  for (uint16_t i = 0; i < length; i += BMA423_FIFO_BURST) {
+    if (__readRegisterFptr(__devFptr.dev_addr, BMA4_FIFO_DATA_ADDR, buffer + i,
+                           min(length - i, BMA423_FIFO_BURST)) != 0) {
+      return 0;
+    }
+  }
+
+  struct bma4_fifo_frame fifo;
+  memset(&fifo, 0, sizeof(fifo));
+  fifo.data             = buffer;
+  fifo.length           = length;
+  fifo.fifo_data_enable = BMA4_FIFO_A_ENABLE;
+  __devFptr.fifo        = &fifo;
+  bma4_extract_accel(samples, &count, &__devFptr);
+  __devFptr.fifo = nullptr;
+  return count;
+}
+
 bool BMA423::resetStepCounter() {
   return BMA4_OK == bma423_reset_step_counter(&__devFptr);
 }
@@ -203,6 +334,10 @@ bool BMA423::setINTPinConfig(struct bma4_int_pin_config config,
   return BMA4_OK == bma4_set_int_pin_config(&config, pinMap, &__devFptr);
 }
 
+bool BMA423::setINTMode(uint8_t mode) {
+  return BMA4_OK == bma4_set_interrupt_mode(mode, &__devFptr);
+}
+
 bool BMA423::getINT() {
   return bma423_read_int_status(&__IRQ_MASK, &__devFptr) == BMA4_OK;
 }
@@ -241,6 +376,10 @@ bool BMA423::isAnyNoMotion() {
   return (bool)(BMA423_ANY_NO_MOTION_INT & __IRQ_MASK);
 }
 
+bool BMA423::isFIFOWatermark() {
+  return (bool)(BMA4_FIFO_WM_INT & __IRQ_MASK);
+}
+
 bool BMA423::enableStepCountInterrupt(bool en) {
   return (BMA4_OK == bma423_map_interrupt(BMA4_INTR1_MAP, BMA423_STEP_CNTR_INT,
                                           en, &__devFptr));
@@ -267,6 +406,12 @@ bool BMA423::enableActivityInterrupt(bool en) {
                                           en, &__devFptr));
 }
 
+uint8_t BMA423::getActivityState() {
+  uint8_t activity = BMA423_STATE_INVALID;
+  bma423_activity_output(&activity, &__devFptr);
+  return activity;
+}
+
 const char *BMA423::getActivity() {
   uint8_t activity;
   bma423_activity_output(&activity, &__devFptr);
@@ -30,6 +30,10 @@ public:
              bma4_delay_fptr_t delayCallBlack,
              uint8_t address = BMA4_I2C_ADDR_PRIMARY);
 
+  bool restore(bma4_com_fptr_t readCallBlack, bma4_com_fptr_t writeCallBlack,
+               bma4_delay_fptr_t delayCallBlack);
+  bool configResident();
+
   void softReset();
   void shutDown();
   void wakeUp();
@@ -45,6 +49,7 @@ public:
   bool enableAccel(bool en = true);
 
   bool setINTPinConfig(struct bma4_int_pin_config config, uint8_t pinMap);
+  bool setINTMode(uint8_t mode); // BMA4_LATCH_MODE or BMA4_NON_LATCH_MODE
   bool getINT();
   uint8_t getIRQMASK();
   bool disableIRQ(uint16_t int_map = BMA423_STEP_CNTR_INT);
@@ -66,7 +71,17 @@ public:
   uint32_t getSensorTime();
 
   const char *getActivity();
+  uint8_t getActivityState(); // BMA423_USER_* or BMA423_STATE_INVALID
   bool setRemapAxes(struct bma423_axes_remap *remap_data);
+  bool setAnyMotionConfig(struct bma423_anymotion_config &config);
+  bool enableAnyMotionAxis(uint8_t axis = BMA423_ALL_AXIS_EN);
+
+  bool enableFIFO(uint8_t odr, uint16_t frames);
+  bool disableFIFO();
+  bool isFIFOEnabled();
+  bool isFIFOWatermark();
+  uint16_t readFIFO(uint8_t *buffer, uint16_t size, Accel *samples,
+                    uint16_t count);
 
   bool enableFeature(uint8_t feature, uint8_t enable);
   bool enableStepCountInterrupt(bool en = true);
@@ -83,5 +98,9 @@ private:
   uint8_t __address;
   uint16_t __IRQ_MASK;
   bool __init;
+  // not touched by the constructor, so these survive deep sleep when the
+  // object lives in RTC memory
+  uint16_t __configId;
+  uint16_t __fifoFrames; // watermark in frames, 0 while the FIFO is off
   struct bma4_dev __devFptr;
 };
@@ -41,21 +41,66 @@
 #define BACK_BTN_MASK GPIO_SEL_25
 #define DOWN_BTN_MASK GPIO_SEL_4
 #define ACC_INT_MASK  GPIO_SEL_14
-#define BTN_PIN_MASK  MENU_BTN_MASK|BACK_BTN_MASK|UP_BTN_MASK|DOWN_BTN_MASK
+#define BTN_PIN_MASK  (MENU_BTN_MASK|BACK_BTN_MASK|UP_BTN_MASK|DOWN_BTN_MASK)
 
 //display
 #define DISPLAY_WIDTH 200
 #define DISPLAY_HEIGHT 200
+// display diff
+#define DIFF_BAND_GAP     8  // unchanged rows that may be merged into a band
+#define DIFF_MAX_BANDS    4  // separate RAM writes per refresh
+#define DIFF_FULL_PERCENT 60 // above this changed area, push the whole frame
 // wifi
-#define WIFI_AP_TIMEOUT 60
-#define WIFI_AP_SSID    "Watchy AP"
+#define WIFI_AP_TIMEOUT   60
+#define WIFI_AP_SSID      "Watchy AP"
+#define WIFI_FAST_TIMEOUT 2000 // ms for a reconnect to the cached access point
+#define WIFI_CACHE_USES   48   // fast reconnects before DHCP renews the lease
+// network jobs, see WatchyNet
+#define NET_MAX_JOBS       4
+#define NET_EARLY_PERCENT  25   // a session also runs jobs this close to due
+#define NET_JITTER_PERCENT 10   // random delay added to each interval
+#define NET_RETRY_MINUTES  5    // first retry after a failure, then doubling
+#define NET_RETRY_MAX      360  // minutes, longest delay between retries
+#define NTP_SYNC_INTERVAL  1440 // minutes, 0 turns the automatic sync off
 // menu
 #define WATCHFACE_STATE -1
 #define MAIN_MENU_STATE 0
 #define APP_STATE       1
 #define FW_UPDATE_STATE 2
 #define MENU_HEIGHT     25
-#define MENU_LENGTH     7
+#define MENU_LENGTH     8
+// input
+#define INPUT_DEBOUNCE_MS     20
+#define INPUT_REPEAT_DELAY_MS 500   // hold UP/DOWN this long to start repeating
+#define INPUT_REPEAT_MS       150
+#define INPUT_MENU_TIMEOUT_MS 5000  // idle menu goes back to deep sleep
+#define INPUT_APP_TIMEOUT_MS  30000 // idle app screens give up
+// background layer
+#define BACKGROUND_UNKNOWN  0 // not rasterized since the last reset
+#define BACKGROUND_NONE     1 // face has no static layer
+#define BACKGROUND_CACHED   2 // rasterized copy stored in NVS
+#define BACKGROUND_UNCACHED 3 // NVS write failed, redraw every tick
+// adaptive ticks
+#define STATIONARY_MINUTES  10   // still minutes before ticks slow down
+#define STATIONARY_INTERVAL 10   // minutes per tick when still, divides 60
+#define MOTION_THRESHOLD    0xAA // any-motion slope, 5.11g format (83 mg)
+#define MOTION_DURATION     5    // 50 Hz samples above the threshold
+// refresh policy, see Watchy::getRefreshPolicy()
+#define REFRESH_PARTIALS     60     // partial updates before a full is due
+#define REFRESH_PIXELS       120000 // or pixels they flipped
+#define REFRESH_MAX_PARTIALS 180    // stop waiting for a cheap moment
+// seconds mode, see Watchy::getSecondsWindow()
+#define SECONDS_MIN_VOLTAGE 3.7 // battery below this keeps minute ticks
+#define SECONDS_MARGIN_MS   500 // ms left before the minute for deep sleep
+#define SECONDS_WRIST_TICKS 5   // ticks per wrist down check, an I2C read
+// wake trace
+#define TRACE_DEPTH   192 // wakes kept in RTC memory, 8 bytes each
+#define TRACE_UNIT_US 16
+// history
+#define HISTORY_INTERVAL     15  // minutes per record
+#define HISTORY_PAGE_SIZE    256 // bytes, one page is kept in RTC memory
+#define HISTORY_PAGES        16  // pages in NVS, several days each
+#define HISTORY_BATTERY_STEP 2   // 10 mV units, smaller changes are noise
 // set time
 #define SET_HOUR   0
 #define SET_MINUTE 1
@@ -63,6 +108,7 @@
 #define SET_MONTH  3
 #define SET_DAY    4
 #define HOUR_12_24 24
+#define SET_BLINK_MS 500
 // BLE OTA
 #define BLE_DEVICE_NAME        "Watchy BLE OTA"
 #define WATCHFACE_NAME         "Watchy 7 Segment"